@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../hash_table/hash.hpp"
+#include "../hash_table/hash_mix.hpp"
+#include "../file_stream/file_stream.hpp"
+#include "../file_stream/positional_reader.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+template <typename t_key, typename t_value>
+class hash_aggregate
+{
+private:
+    static constexpr int read_batch = 4096;
+    static constexpr int route_batch = 1024;
+    static constexpr int max_queued_batches = 4;
+    static constexpr int spill_fanout = 8;
+    static constexpr int max_depth = 6;
+
+    struct batch_queue
+    {
+        std::deque<std::vector<entry<t_key, t_value>>> batches;
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool closed = false;
+        bool failed = false;
+    };
+
+    struct partition_state
+    {
+        hash_table<t_key, t_value> table;
+        array_sequence<file_stream<entry<t_key, t_value>> *> spills;
+        array_sequence<std::string> spill_paths;
+        int depth;
+
+        ~partition_state()
+        {
+            for (int p = 0; p < spills.get_length(); p++)
+            {
+                delete spills[p];
+            }
+            for (int p = 0; p < spill_paths.get_length(); p++)
+            {
+                std::remove(spill_paths[p].c_str());
+            }
+        }
+    };
+
+    std::function<int(const t_key &)> hash_function;
+    std::function<t_value(const t_value &, const t_value &)> merge;
+    std::function<void(const t_key &, const t_value &)> output;
+
+    std::string spill_prefix;
+    int max_entries;
+    int threads;
+
+    std::mutex output_mutex;
+    std::atomic<int> next_spill_id;
+    std::atomic<int> spill_count;
+
+public:
+    hash_aggregate(const std::function<int(const t_key &)> &hash_function,
+                   const std::function<t_value(const t_value &, const t_value &)> &merge,
+                   int max_entries,
+                   int threads = 0,
+                   const std::string &spill_prefix = "aggregate_spill");
+    ~hash_aggregate() = default;
+
+    void run(const std::string &input_path, const std::function<void(const t_key &, const t_value &)> &output);
+    hash_table<t_key, t_value> run(const std::string &input_path);
+
+    int get_spill_count() const;
+
+private:
+    void worker(batch_queue &queue, int entry_limit);
+    void consume(partition_state &state, const entry<t_key, t_value> &item, int entry_limit);
+    void spill(partition_state &state);
+    void finish(partition_state &state, int entry_limit);
+    void aggregate_spill(const std::string &path, int depth, int entry_limit);
+    void emit(const t_key &key, const t_value &value);
+
+    int partition_of(const t_key &key, int depth, int partitions) const;
+};
+
+#include "hash_aggregate.tpp"
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "hash_aggregate.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+template <typename t_key, typename t_value>
+hash_aggregate<t_key, t_value>::hash_aggregate(const std::function<int(const t_key &)> &hash_func,
+                                               const std::function<t_value(const t_value &, const t_value &)> &merge_func,
+                                               int max_entries,
+                                               int threads,
+                                               const std::string &spill_prefix)
+    : hash_function(hash_func), merge(merge_func), spill_prefix(spill_prefix), max_entries(max_entries), threads(threads),
+      next_spill_id(0), spill_count(0)
+{
+    if (max_entries <= 0)
+    {
+        throw std::invalid_argument("Memory budget must be positive");
+    }
+    if (this->threads <= 0)
+    {
+        this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::run(const std::string &input_path, const std::function<void(const t_key &, const t_value &)> &output_func)
+{
+    output = output_func;
+    positional_reader<entry<t_key, t_value>> input(input_path);
+    int entry_limit = std::max(1, max_entries / threads);
+
+    std::vector<batch_queue> queues(threads);
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> pool;
+    for (int w = 0; w < threads; w++)
+    {
+        pool.emplace_back([this, &queues, &errors, w, entry_limit]()
+        {
+            try
+            {
+                worker(queues[w], entry_limit);
+            }
+            catch (...)
+            {
+                errors[w] = std::current_exception();
+                std::lock_guard<std::mutex> lock(queues[w].mutex);
+                queues[w].failed = true;
+                queues[w].changed.notify_all();
+            }
+        });
+    }
+
+    auto push = [&](int w, std::vector<entry<t_key, t_value>> &routed)
+    {
+        std::unique_lock<std::mutex> lock(queues[w].mutex);
+        queues[w].changed.wait(lock, [&]() { return queues[w].batches.size() < max_queued_batches || queues[w].failed; });
+        if (!queues[w].failed)
+        {
+            queues[w].batches.push_back(std::move(routed));
+        }
+        routed.clear();
+        queues[w].changed.notify_all();
+    };
+
+    std::exception_ptr read_error;
+    try
+    {
+        std::vector<entry<t_key, t_value>> batch(read_batch);
+        std::vector<std::vector<entry<t_key, t_value>>> routed(threads);
+        int count = input.get_count();
+        for (int first = 0; first < count; first += read_batch)
+        {
+            int read = input.read_range(first, batch.data(), std::min(read_batch, count - first));
+            for (int i = 0; i < read; i++)
+            {
+                int w = partition_of(batch[i].key, 0, threads);
+                routed[w].push_back(batch[i]);
+                if (static_cast<int>(routed[w].size()) == route_batch)
+                {
+                    push(w, routed[w]);
+                }
+            }
+        }
+        for (int w = 0; w < threads; w++)
+        {
+            if (!routed[w].empty())
+            {
+                push(w, routed[w]);
+            }
+        }
+    }
+    catch (...)
+    {
+        read_error = std::current_exception();
+    }
+
+    for (int w = 0; w < threads; w++)
+    {
+        std::lock_guard<std::mutex> lock(queues[w].mutex);
+        queues[w].closed = true;
+        queues[w].changed.notify_all();
+    }
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+
+    if (read_error)
+    {
+        std::rethrow_exception(read_error);
+    }
+    for (const auto &error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template <typename t_key, typename t_value>
+hash_table<t_key, t_value> hash_aggregate<t_key, t_value>::run(const std::string &input_path)
+{
+    hash_table<t_key, t_value> result(hash_function);
+    run(input_path, [&result](const t_key &key, const t_value &value)
+    {
+        result.set(key, value);
+    });
+    return result;
+}
+
+template <typename t_key, typename t_value>
+int hash_aggregate<t_key, t_value>::get_spill_count() const
+{
+    return spill_count;
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::worker(batch_queue &queue, int entry_limit)
+{
+    partition_state state{hash_table<t_key, t_value>(hash_function), {}, {}, 0};
+    while (true)
+    {
+        std::vector<entry<t_key, t_value>> batch;
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.changed.wait(lock, [&]() { return !queue.batches.empty() || queue.closed; });
+            if (queue.batches.empty())
+            {
+                break;
+            }
+            batch = std::move(queue.batches.front());
+            queue.batches.pop_front();
+            queue.changed.notify_all();
+        }
+
+        for (const auto &item : batch)
+        {
+            consume(state, item, entry_limit);
+        }
+    }
+    finish(state, entry_limit);
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::consume(partition_state &state, const entry<t_key, t_value> &item, int entry_limit)
+{
+    if (state.table.contains_key(item.key))
+    {
+        state.table.set(item.key, merge(state.table.get(item.key), item.value));
+        return;
+    }
+
+    if (state.table.get_count() >= entry_limit && state.depth < max_depth)
+    {
+        spill(state);
+    }
+    state.table.set(item.key, item.value);
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::spill(partition_state &state)
+{
+    if (state.spills.get_length() == 0)
+    {
+        for (int p = 0; p < spill_fanout; p++)
+        {
+            std::string path = spill_prefix + "_" + std::to_string(next_spill_id++) + ".bin";
+            std::remove(path.c_str());
+            state.spill_paths.append_element(path);
+            state.spills.append_element(new file_stream<entry<t_key, t_value>>(path));
+        }
+    }
+
+    if (state.table.get_count() > 0)
+    {
+        auto iterator = state.table.get_keys_iterator();
+        do
+        {
+            t_key key = iterator->get_current();
+            state.spills[partition_of(key, state.depth + 1, spill_fanout)]->write(entry<t_key, t_value>(key, state.table.get(key)));
+        } while (iterator->next());
+        delete iterator;
+    }
+
+    state.table = hash_table<t_key, t_value>(hash_function);
+    spill_count++;
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::finish(partition_state &state, int entry_limit)
+{
+    if (state.spills.get_length() == 0)
+    {
+        if (state.table.get_count() > 0)
+        {
+            auto iterator = state.table.get_keys_iterator();
+            do
+            {
+                t_key key = iterator->get_current();
+                emit(key, state.table.get(key));
+            } while (iterator->next());
+            delete iterator;
+        }
+        return;
+    }
+
+    spill(state);
+    for (int p = 0; p < state.spills.get_length(); p++)
+    {
+        delete state.spills[p];
+    }
+    state.spills = array_sequence<file_stream<entry<t_key, t_value>> *>();
+    for (int p = 0; p < state.spill_paths.get_length(); p++)
+    {
+        aggregate_spill(state.spill_paths[p], state.depth + 1, entry_limit);
+        std::remove(state.spill_paths[p].c_str());
+    }
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::aggregate_spill(const std::string &path, int depth, int entry_limit)
+{
+    partition_state state{hash_table<t_key, t_value>(hash_function), {}, {}, depth};
+    {
+        positional_reader<entry<t_key, t_value>> input(path);
+        std::vector<entry<t_key, t_value>> batch(read_batch);
+        int count = input.get_count();
+        for (int first = 0; first < count; first += read_batch)
+        {
+            int read = input.read_range(first, batch.data(), std::min(read_batch, count - first));
+            for (int i = 0; i < read; i++)
+            {
+                consume(state, batch[i], entry_limit);
+            }
+        }
+    }
+    finish(state, entry_limit);
+}
+
+template <typename t_key, typename t_value>
+void hash_aggregate<t_key, t_value>::emit(const t_key &key, const t_value &value)
+{
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output(key, value);
+}
+
+template <typename t_key, typename t_value>
+int hash_aggregate<t_key, t_value>::partition_of(const t_key &key, int depth, int partitions) const
+{
+    uint64_t hash = static_cast<uint32_t>(hash_function(key));
+    return static_cast<int>(mix64(hash + 0x9e3779b97f4a7c15ULL * depth) % static_cast<uint64_t>(partitions));
+}
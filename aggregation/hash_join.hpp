@@ -0,0 +1,71 @@
+#pragma once
+
+#include "../hash_table/hash.hpp"
+#include "../hash_table/hash_mix.hpp"
+#include "../hash_table/run_parallel.hpp"
+#include "../file_stream/file_stream.hpp"
+#include "../file_stream/positional_reader.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+template <typename t_key, typename t_left, typename t_right>
+class hash_join
+{
+private:
+    static constexpr int read_batch = 4096;
+    static constexpr int min_probe_chunk = 16384;
+    static constexpr int max_fan_out = 64;
+    static constexpr int max_depth = 4;
+
+    struct build_row
+    {
+        t_left value;
+        int next;
+    };
+
+    struct build_side
+    {
+        hash_table<t_key, int> heads;
+        std::vector<build_row> rows;
+    };
+
+    std::function<int(const t_key &)> hash_function;
+    std::function<void(const t_key &, const t_left &, const t_right &)> output;
+
+    std::string spill_prefix;
+    int max_build_entries;
+    int threads;
+    std::atomic<int> partition_count;
+
+    std::mutex output_mutex;
+
+public:
+    hash_join(const std::function<int(const t_key &)> &hash_function,
+              int max_build_entries,
+              int threads = 0,
+              const std::string &spill_prefix = "join_spill");
+    ~hash_join() = default;
+
+    void run(const std::string &build_path,
+             const std::string &probe_path,
+             const std::function<void(const t_key &, const t_left &, const t_right &)> &output);
+
+    int get_partition_count() const;
+
+private:
+    void build(build_side &side, const std::string &path, int first, int last) const;
+    void probe(const build_side &side, const std::string &path, int first, int last);
+    void join_partitions(const std::string &build_path, const std::string &probe_path, const std::string &prefix, int depth);
+
+    template <typename t_value>
+    void partition(const std::string &path, const std::string &prefix, int fan_out, int depth);
+
+    std::string partition_path(const std::string &prefix, int index) const;
+    int partition_of(const t_key &key, int fan_out, int depth) const;
+};
+
+#include "hash_join.tpp"
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "hash_join.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+
+template <typename t_key, typename t_left, typename t_right>
+hash_join<t_key, t_left, t_right>::hash_join(const std::function<int(const t_key &)> &hash_func,
+                                             int max_build_entries,
+                                             int threads,
+                                             const std::string &spill_prefix)
+    : hash_function(hash_func), spill_prefix(spill_prefix), max_build_entries(max_build_entries), threads(threads), partition_count(0)
+{
+    if (max_build_entries <= 0)
+    {
+        throw std::invalid_argument("Memory budget must be positive");
+    }
+    if (this->threads <= 0)
+    {
+        this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+template <typename t_key, typename t_left, typename t_right>
+void hash_join<t_key, t_left, t_right>::run(const std::string &build_path,
+                                            const std::string &probe_path,
+                                            const std::function<void(const t_key &, const t_left &, const t_right &)> &output_func)
+{
+    output = output_func;
+    partition_count = 0;
+    int build_count = positional_reader<entry<t_key, t_left>>(build_path).get_count();
+
+    if (build_count <= max_build_entries)
+    {
+        build_side side{hash_table<t_key, int>(hash_function, std::max(8, build_count)), {}};
+        build(side, build_path, 0, build_count);
+
+        int probe_count = positional_reader<entry<t_key, t_right>>(probe_path).get_count();
+        int chunk = std::max(min_probe_chunk, (probe_count + threads - 1) / threads);
+        run_parallel((probe_count + chunk - 1) / chunk, threads, [&](int task)
+        {
+            probe(side, probe_path, task * chunk, std::min(probe_count, (task + 1) * chunk));
+        });
+        return;
+    }
+
+    join_partitions(build_path, probe_path, spill_prefix, 0);
+}
+
+template <typename t_key, typename t_left, typename t_right>
+int hash_join<t_key, t_left, t_right>::get_partition_count() const
+{
+    return partition_count;
+}
+
+template <typename t_key, typename t_left, typename t_right>
+void hash_join<t_key, t_left, t_right>::build(build_side &side, const std::string &path, int first, int last) const
+{
+    positional_reader<entry<t_key, t_left>> input(path);
+    std::vector<entry<t_key, t_left>> batch(read_batch);
+    side.rows.reserve(last - first);
+    for (int position = first; position < last; position += read_batch)
+    {
+        int read = input.read_range(position, batch.data(), std::min(read_batch, last - position));
+        for (int i = 0; i < read; i++)
+        {
+            int next = side.heads.contains_key(batch[i].key) ? side.heads.get(batch[i].key) : -1;
+            side.rows.push_back(build_row{batch[i].value, next});
+            side.heads.set(batch[i].key, static_cast<int>(side.rows.size()) - 1);
+        }
+    }
+}
+
+template <typename t_key, typename t_left, typename t_right>
+void hash_join<t_key, t_left, t_right>::probe(const build_side &side, const std::string &path, int first, int last)
+{
+    positional_reader<entry<t_key, t_right>> input(path);
+    std::vector<entry<t_key, t_right>> batch(read_batch);
+    for (int position = first; position < last; position += read_batch)
+    {
+        int read = input.read_range(position, batch.data(), std::min(read_batch, last - position));
+        for (int i = 0; i < read; i++)
+        {
+            if (!side.heads.contains_key(batch[i].key))
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(output_mutex);
+            for (int row = side.heads.get(batch[i].key); row != -1; row = side.rows[row].next)
+            {
+                output(batch[i].key, side.rows[row].value, batch[i].value);
+            }
+        }
+    }
+}
+
+template <typename t_key, typename t_left, typename t_right>
+void hash_join<t_key, t_left, t_right>::join_partitions(const std::string &build_path,
+                                                        const std::string &probe_path,
+                                                        const std::string &prefix,
+                                                        int depth)
+{
+    int build_count = positional_reader<entry<t_key, t_left>>(build_path).get_count();
+    int fan_out = std::min(max_fan_out, std::max(depth == 0 ? threads : 2, (2 * build_count + max_build_entries - 1) / max_build_entries));
+    const std::string build_prefix = prefix + "_build";
+    const std::string probe_prefix = prefix + "_probe";
+
+    try
+    {
+        partition<t_left>(build_path, build_prefix, fan_out, depth);
+        partition<t_right>(probe_path, probe_prefix, fan_out, depth);
+
+        run_parallel(fan_out, depth == 0 ? threads : 1, [&](int p)
+        {
+            std::string build_part = partition_path(build_prefix, p);
+            std::string probe_part = partition_path(probe_prefix, p);
+            int part_count = positional_reader<entry<t_key, t_left>>(build_part).get_count();
+
+            if (part_count > max_build_entries && part_count < build_count && depth + 1 < max_depth)
+            {
+                join_partitions(build_part, probe_part, prefix + "_" + std::to_string(p), depth + 1);
+            }
+            else
+            {
+                build_side side{hash_table<t_key, int>(hash_function, std::max(8, part_count)), {}};
+                build(side, build_part, 0, part_count);
+                probe(side, probe_part, 0, positional_reader<entry<t_key, t_right>>(probe_part).get_count());
+                partition_count++;
+            }
+            std::remove(build_part.c_str());
+            std::remove(probe_part.c_str());
+        });
+    }
+    catch (...)
+    {
+        for (int p = 0; p < fan_out; p++)
+        {
+            std::remove(partition_path(build_prefix, p).c_str());
+            std::remove(partition_path(probe_prefix, p).c_str());
+        }
+        throw;
+    }
+}
+
+template <typename t_key, typename t_left, typename t_right>
+template <typename t_value>
+void hash_join<t_key, t_left, t_right>::partition(const std::string &path, const std::string &prefix, int fan_out, int depth)
+{
+    array_sequence<file_stream<entry<t_key, t_value>> *> parts;
+    for (int p = 0; p < fan_out; p++)
+    {
+        std::string part_path = partition_path(prefix, p);
+        std::remove(part_path.c_str());
+        parts.append_element(new file_stream<entry<t_key, t_value>>(part_path));
+    }
+
+    try
+    {
+        positional_reader<entry<t_key, t_value>> input(path);
+        std::vector<entry<t_key, t_value>> batch(read_batch);
+        int count = input.get_count();
+        for (int first = 0; first < count; first += read_batch)
+        {
+            int read = input.read_range(first, batch.data(), std::min(read_batch, count - first));
+            for (int i = 0; i < read; i++)
+            {
+                parts[partition_of(batch[i].key, fan_out, depth)]->write(batch[i]);
+            }
+        }
+    }
+    catch (...)
+    {
+        for (int p = 0; p < parts.get_length(); p++)
+        {
+            delete parts[p];
+        }
+        throw;
+    }
+
+    for (int p = 0; p < parts.get_length(); p++)
+    {
+        delete parts[p];
+    }
+}
+
+template <typename t_key, typename t_left, typename t_right>
+std::string hash_join<t_key, t_left, t_right>::partition_path(const std::string &prefix, int index) const
+{
+    return prefix + "_" + std::to_string(index) + ".bin";
+}
+
+template <typename t_key, typename t_left, typename t_right>
+int hash_join<t_key, t_left, t_right>::partition_of(const t_key &key, int fan_out, int depth) const
+{
+    uint64_t salt = static_cast<uint64_t>(depth) * 0x9e3779b97f4a7c15ULL;
+    return static_cast<int>(mix64(static_cast<uint32_t>(hash_function(key)) ^ salt) % static_cast<uint64_t>(fan_out));
+}
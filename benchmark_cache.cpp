@@ -1,11 +1,23 @@
 #include "cache.hpp"
 #include "hash_table/hash.hpp"
+#include "hash_table/cuckoo_table.hpp"
+#include "hash_table/hash_analyzer.hpp"
+#include "hash_table/separated_table.hpp"
 #include "file_stream/file_stream.hpp"
 #include "benchmark_utils.hpp"
+#include "trace/trace_replay.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <fstream>
 #include <iostream>
 #include <filesystem>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+static bool use_counters = true;
 
 struct benchmark_result
 {
@@ -15,19 +27,44 @@ struct benchmark_result
     int hits;
     int misses;
     double hit_ratio;
+    double counters[perf_counters::event_count];
 };
 
+void read_counters(const perf_counters &counters, int64_t operations, double *per_op)
+{
+    for (int e = 0; e < perf_counters::event_count; e++)
+    {
+        per_op[e] = counters.per_op(static_cast<perf_event>(e), operations);
+    }
+}
+
+void print_counters(std::ostream &out, const double *per_op, const char *separator)
+{
+    for (int e = 0; e < perf_counters::event_count; e++)
+    {
+        out << separator;
+        if (per_op[e] < 0)
+        {
+            out << "n/a";
+        }
+        else
+        {
+            out << per_op[e];
+        }
+    }
+}
+
 benchmark_result run_cache_benchmark(
     int cache_size,
     const array_sequence<int> &workload,
+    const std::function<int(const int &)> &hash_fn,
     const std::string &db_file = "cache_db.bin")
 {
-    auto hash_fn = [](int k)
-    { return k % 1000; };
-
     cache<int, int> my_cache(cache_size, 50, hash_fn, db_file);
     my_cache.reset_statistics();
 
+    perf_counters counters(use_counters);
+    counters.start();
     auto start = std::chrono::high_resolution_clock::now();
 
     for (int i = 0; i < workload.get_length(); i++)
@@ -36,15 +73,60 @@ benchmark_result run_cache_benchmark(
     }
 
     auto end = std::chrono::high_resolution_clock::now();
+    counters.stop();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-    return {
+    benchmark_result result{
         cache_size,
         static_cast<int>(workload.get_length()),
         duration.count() / 1000.0, // мс
         my_cache.get_hit_count(),
         my_cache.get_miss_count(),
-        my_cache.get_hit_ratio()};
+        my_cache.get_hit_ratio(),
+        {}};
+    read_counters(counters, workload.get_length(), result.counters);
+    return result;
+}
+
+std::function<int(const int &)> select_hasher(const array_sequence<int> &workload, int bucket_count)
+{
+    array_sequence<const char *> names = {"k % 1000", "identity", "mix64"};
+    array_sequence<std::function<int(const int &)>> hashers;
+    hashers.append_element([](const int &k) { return k % 1000; });
+    hashers.append_element([](const int &k) { return k & 0x7fffffff; });
+    hashers.append_element([](const int &k) { return static_cast<int>(mix64(static_cast<uint64_t>(k)) & 0x7fffffff); });
+
+    std::vector<int> distinct(workload.get_length());
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        distinct[i] = workload.get(i);
+    }
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+    array_sequence<int> sample;
+    for (int key : distinct)
+    {
+        sample.append_element(key);
+    }
+
+    hash_analyzer<int> analyzer(sample, bucket_count);
+    array_sequence<hash_report> reports = analyzer.compare(hashers);
+    int best = analyzer.select(hashers);
+
+    std::cout << "Hasher   | Chi2/df | Max chain | Mean chain | Probes/lookup\n";
+    std::cout << "---------|---------|-----------|------------|--------------\n";
+    for (int h = 0; h < reports.get_length(); h++)
+    {
+        const auto &r = reports.get(h);
+        std::cout << names.get(h) << " | "
+                  << r.uniformity << " | "
+                  << r.max_chain << " | "
+                  << r.mean_chain << " | "
+                  << r.expected_probes << (h == best ? " *" : "") << "\n";
+    }
+    std::cout << "\n";
+    return hashers.get(best);
 }
 
 void benchmark_scenario()
@@ -55,13 +137,19 @@ void benchmark_scenario()
     array_sequence<int> cache_sizes = {5, 10, 20, 50, 100, 200, 500, 1000};
     array_sequence<benchmark_result> results;
 
+    auto hash_fn = select_hasher(workload, cache_sizes.get(cache_sizes.get_length() - 1) * 4);
     for (int i = 0; i < cache_sizes.get_length(); i++)
     {
-        results.append_element(run_cache_benchmark(cache_sizes.get(i), workload));
+        results.append_element(run_cache_benchmark(cache_sizes.get(i), workload, hash_fn));
     }
 
     std::ofstream csv("cache_benchmark.csv");
-    csv << "cache_size,requests,duration_ms,hits,misses,hit_ratio\n";
+    csv << "cache_size,requests,duration_ms,hits,misses,hit_ratio";
+    for (int e = 0; e < perf_counters::event_count; e++)
+    {
+        csv << "," << perf_counters::event_name(static_cast<perf_event>(e)) << "_per_op";
+    }
+    csv << "\n";
     for (int i = 0; i < results.get_length(); i++)
     {
         const auto &r = results.get(i);
@@ -70,21 +158,256 @@ void benchmark_scenario()
             << r.duration_ms << ","
             << r.hits << ","
             << r.misses << ","
-            << r.hit_ratio << "\n";
+            << r.hit_ratio;
+        print_counters(csv, r.counters, ",");
+        csv << "\n";
     }
-    std::cout << "Cache size | Hit ratio | Time (ms)\n";
-    std::cout << "-----------|-----------|-----------\n";
+    std::cout << "Cache size | Hit ratio | Time (ms) | cycles/op | instr/op | L1d/op | LLC/op | br-miss/op | dTLB/op\n";
+    std::cout << "-----------|-----------|-----------|-----------|----------|--------|--------|------------|--------\n";
     for (int i = 0; i < results.get_length(); i++)
     {
         const auto &r = results.get(i);
         std::cout << r.cache_size << "        | "
                   << r.hit_ratio * 100 << "%      | "
-                  << r.duration_ms << "\n";
+                  << r.duration_ms;
+        print_counters(std::cout, r.counters, " | ");
+        std::cout << "\n";
+    }
+}
+
+void trace_scenario()
+{
+    const int key_space = 2000;
+    generate_sequential_database<int, int>("trace_db.bin", key_space);
+    write_workload_trace<int, int>("zipf_trace.bin", generate_zipf_workload(20000, key_space, 0.99));
+
+    array_sequence<int> cache_sizes = {10, 50, 100, 200, 500, 1000};
+    auto results = replay_trace_sizes<int, int, cache<int, int>>("zipf_trace.bin", cache_sizes, [&](int size)
+    {
+        return new cache<int, int>(size, key_space, [](int k) { return k; }, "trace_db.bin");
+    });
+
+    std::cout << "\nZipf trace replay\n";
+    std::cout << "Cache size | Hit ratio | Ops/s | p50 (us) | p99 (us)\n";
+    std::cout << "-----------|-----------|-------|----------|---------\n";
+    for (int i = 0; i < results.get_length(); i++)
+    {
+        const auto &r = results.get(i);
+        std::cout << r.capacity << "        | "
+                  << r.hit_ratio * 100 << "%      | "
+                  << r.throughput << " | "
+                  << r.p50_us << " | "
+                  << r.p99_us << "\n";
+    }
+}
+
+void range_scenario()
+{
+    const int key_space = 20000;
+    const int range_length = 500;
+    generate_sequential_database<int, int>("range_db.bin", key_space);
+
+    std::cout << "\nRange reports (" << range_length << " keys per report)\n";
+    std::cout << "Read-ahead | Misses | Prefetched | Time (ms)\n";
+    std::cout << "-----------|--------|------------|----------\n";
+    for (int depth = 0; depth <= 32; depth += 32)
+    {
+        cache<int, int> my_cache(1000, key_space, [](const int &k) { return k; }, "range_db.bin");
+        my_cache.enable_read_ahead(depth, 16);
+
+        long long checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int first = 0; first + range_length <= 5000; first += range_length)
+        {
+            for (int key = first; key < first + range_length; key++)
+            {
+                checksum += my_cache.get(key);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::cout << depth << "         | "
+                  << my_cache.get_miss_count() << " | "
+                  << my_cache.get_prefetched_count() << " | "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0 << "\n";
+        if (checksum == 0)
+        {
+            std::cout << "\n";
+        }
+    }
+    std::filesystem::remove("range_db.bin");
+}
+
+void partition_scenario()
+{
+    const int size = 400000;
+
+    std::cout << "\nPartitioned store (" << size << " records)\n";
+    std::cout << "Partitions | Load (ms) | Scan (ms)\n";
+    std::cout << "-----------|-----------|----------\n";
+    for (int partitions = 1; partitions <= 4; partitions *= 2)
+    {
+        array_sequence<std::string> paths;
+        for (int p = 0; p < partitions; p++)
+        {
+            paths.append_element("partition_db_" + std::to_string(p) + ".bin");
+            std::filesystem::remove(paths.get(p));
+        }
+
+        long long checksum = 0;
+        double load_ms = 0.0;
+        double scan_ms = 0.0;
+        {
+            partitioned_store<int, int> store(paths, [](const int &k) { return k; });
+
+            auto start = std::chrono::high_resolution_clock::now();
+            generate_partitioned_database(store, size);
+            auto loaded = std::chrono::high_resolution_clock::now();
+
+            std::atomic<long long> sum(0);
+            store.scan([&](int, const entry<int, int> &item) { sum += item.value; });
+            auto scanned = std::chrono::high_resolution_clock::now();
+
+            checksum = sum.load();
+            load_ms = std::chrono::duration_cast<std::chrono::microseconds>(loaded - start).count() / 1000.0;
+            scan_ms = std::chrono::duration_cast<std::chrono::microseconds>(scanned - loaded).count() / 1000.0;
+        }
+
+        std::cout << partitions << "          | " << load_ms << " | " << scan_ms << "\n";
+        for (int p = 0; p < partitions; p++)
+        {
+            std::filesystem::remove(paths.get(p));
+        }
+        if (checksum == 0)
+        {
+            std::cout << "\n";
+        }
+    }
+}
+
+template <typename t_table>
+double measure_lookups(const t_table &table, const array_sequence<int> &keys, long long &checksum, double *per_op)
+{
+    perf_counters counters(use_counters);
+    counters.start();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < keys.get_length(); i++)
+    {
+        checksum += table.get(keys.get(i));
     }
+    auto end = std::chrono::high_resolution_clock::now();
+    counters.stop();
+    read_counters(counters, keys.get_length(), per_op);
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
 }
 
-int main()
+void table_scenario()
 {
+    const int size = 200000;
+    hash_table<int, int> chained([](const int &k) { return k & 0x7fffffff; }, size * 2);
+    cuckoo_table<int, int> cuckoo(std::hash<int>(), size);
+
+    for (int i = 0; i < size; i++)
+    {
+        chained.set(i * 7, i);
+        cuckoo.set(i * 7, i);
+    }
+
+    std::mt19937 gen(7);
+    array_sequence<int> keys;
+    for (int i = 0; i < 1000000; i++)
+    {
+        keys.append_element(static_cast<int>(gen() % size) * 7);
+    }
+
+    long long checksum = 0;
+    double chained_counters[perf_counters::event_count];
+    double cuckoo_counters[perf_counters::event_count];
+    double chained_ms = measure_lookups(chained, keys, checksum, chained_counters);
+    double cuckoo_ms = measure_lookups(cuckoo, keys, checksum, cuckoo_counters);
+
+    std::cout << "\nTable lookups (" << keys.get_length() << " gets, " << size << " keys)\n";
+    std::cout << "Table        | Time (ms) | cycles/op | instr/op | L1d/op | LLC/op | br-miss/op | dTLB/op\n";
+    std::cout << "hash_table   | " << chained_ms;
+    print_counters(std::cout, chained_counters, " | ");
+    std::cout << "\ncuckoo_table | " << cuckoo_ms;
+    print_counters(std::cout, cuckoo_counters, " | ");
+    std::cout << "\ncuckoo_table load factor " << cuckoo.get_load_factor() << "\n";
+    if (checksum == 0)
+    {
+        std::cout << "\n";
+    }
+}
+
+template <typename t_table>
+void measure_large_values(t_table &table, const char *name, int size, const array_sequence<int> &keys)
+{
+    std::array<char, 256> value{};
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < size; i++)
+    {
+        value[0] = static_cast<char>(i);
+        table.set(i * 7, value);
+    }
+    auto loaded = std::chrono::high_resolution_clock::now();
+
+    long long checksum = 0;
+    for (int i = 0; i < keys.get_length(); i++)
+    {
+        checksum += table.get(keys.get(i))[0];
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << name << " | "
+              << std::chrono::duration_cast<std::chrono::microseconds>(loaded - start).count() / 1000.0 << " | "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - loaded).count() / 1000.0 << "\n";
+    if (checksum == 1)
+    {
+        std::cout << "\n";
+    }
+}
+
+void large_value_scenario()
+{
+    const int size = 200000;
+    std::mt19937 gen(11);
+    array_sequence<int> keys;
+    for (int i = 0; i < 1000000; i++)
+    {
+        keys.append_element(static_cast<int>(gen() % size) * 7);
+    }
+
+    std::cout << "\nLarge values (256 bytes, " << size << " keys, growing from empty)\n";
+    std::cout << "Table           | Insert (ms) | Lookup (ms)\n";
+    {
+        cuckoo_table<int, std::array<char, 256>> cuckoo(std::hash<int>(), 8);
+        measure_large_values(cuckoo, "cuckoo_table   ", size, keys);
+    }
+    {
+        separated_table<int, std::array<char, 256>> separated(std::hash<int>(), 8);
+        measure_large_values(separated, "separated_table", size, keys);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--no-counters") == 0)
+        {
+            use_counters = false;
+        }
+    }
+    if (use_counters && !perf_counters().is_available())
+    {
+        std::cout << "Hardware counters unavailable, reporting wall time only\n";
+    }
+
     benchmark_scenario();
+    trace_scenario();
+    table_scenario();
+    large_value_scenario();
+    partition_scenario();
+    range_scenario();
     return 0;
 }
\ No newline at end of file
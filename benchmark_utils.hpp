@@ -1,15 +1,17 @@
 #pragma once
 
 #include "file_stream/file_stream.hpp"
+#include "file_stream/partitioned_store.hpp"
 #include "hash_table/entry.hpp"
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <vector>
 
 template <typename t_key, typename t_value>
-void generate_database(const std::string &file_path, int size)
+array_sequence<entry<t_key, t_value>> generate_database_records(int size)
 {
-    file_stream<entry<t_key, t_value>> stream(file_path);
-    stream.move_position(0);
+    array_sequence<entry<t_key, t_value>> records;
 
     const int HOT_KEYS = 50;
     const int COLD_KEYS = 100;
@@ -17,7 +19,7 @@ void generate_database(const std::string &file_path, int size)
 
     for (int i = 0; i < HOT_KEYS; ++i)
     {
-        stream.write(entry<t_key, t_value>{
+        records.append_element(entry<t_key, t_value>{
             static_cast<t_key>(i),
             static_cast<t_value>(i * 1000 + 42)
         });
@@ -25,7 +27,7 @@ void generate_database(const std::string &file_path, int size)
 
     for (int i = 0; i < COLD_KEYS; ++i)
     {
-        stream.write(entry<t_key, t_value>{
+        records.append_element(entry<t_key, t_value>{
             static_cast<t_key>(COLD_KEYS_START + i),
             static_cast<t_value>(i * 2000 + 123)});
     }
@@ -38,12 +40,32 @@ void generate_database(const std::string &file_path, int size)
     {
         t_key key = static_cast<t_key>(cold_key_dist(gen));
         t_value value = static_cast<t_value>(val_dist(gen));
-        stream.write(entry<t_key, t_value>{key, value});
+        records.append_element(entry<t_key, t_value>{key, value});
+    }
+    return records;
+}
+
+template <typename t_key, typename t_value>
+void generate_database(const std::string &file_path, int size)
+{
+    file_stream<entry<t_key, t_value>> stream(file_path);
+    stream.move_position(0);
+
+    auto records = generate_database_records<t_key, t_value>(size);
+    for (int i = 0; i < records.get_length(); ++i)
+    {
+        stream.write(records.get(i));
     }
     stream.reset();
 }
 
-array_sequence<int> generate_workload(int total_requests)
+template <typename t_key, typename t_value>
+void generate_partitioned_database(partitioned_store<t_key, t_value> &store, int size)
+{
+    store.load(generate_database_records<t_key, t_value>(size));
+}
+
+inline array_sequence<int> generate_workload(int total_requests)
 {
     array_sequence<int> workload;
 
@@ -69,5 +91,136 @@ array_sequence<int> generate_workload(int total_requests)
         }
     }
 
+    return workload;
+}
+
+template <typename t_key, typename t_value>
+void generate_sequential_database(const std::string &file_path, int key_space)
+{
+    file_stream<entry<t_key, t_value>> stream(file_path);
+    stream.move_position(0);
+
+    for (int i = 0; i < key_space; ++i)
+    {
+        stream.write(entry<t_key, t_value>{
+            static_cast<t_key>(i),
+            static_cast<t_value>(i * 1000 + 42)});
+    }
+    stream.reset();
+}
+
+class zipf_distribution
+{
+private:
+    std::vector<double> cdf;
+
+public:
+    zipf_distribution(int key_space, double skew) : cdf(key_space)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < key_space; ++i)
+        {
+            sum += 1.0 / std::pow(i + 1, skew);
+            cdf[i] = sum;
+        }
+        for (int i = 0; i < key_space; ++i)
+        {
+            cdf[i] /= sum;
+        }
+    }
+
+    template <typename t_gen>
+    int operator()(t_gen &gen) const
+    {
+        double p = std::uniform_real_distribution<>(0.0, 1.0)(gen);
+        int rank = static_cast<int>(std::lower_bound(cdf.begin(), cdf.end(), p) - cdf.begin());
+        return rank < static_cast<int>(cdf.size()) ? rank : static_cast<int>(cdf.size()) - 1;
+    }
+};
+
+inline array_sequence<int> generate_zipf_workload(int total_requests, int key_space, double skew, unsigned seed = 123)
+{
+    array_sequence<int> workload;
+
+    std::mt19937 gen(seed);
+    zipf_distribution zipf(key_space, skew);
+
+    for (int i = 0; i < total_requests; ++i)
+    {
+        workload.append_element(zipf(gen));
+    }
+
+    return workload;
+}
+
+inline array_sequence<int> generate_scan_workload(int total_requests, int key_space, double skew,
+                                                  int scan_length, double scan_probability, unsigned seed = 123)
+{
+    array_sequence<int> workload;
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<> prob_dist(0.0, 1.0);
+    std::uniform_int_distribution<> start_dist(0, key_space - 1);
+    zipf_distribution zipf(key_space, skew);
+
+    while (workload.get_length() < total_requests)
+    {
+        if (prob_dist(gen) < scan_probability)
+        {
+            int start = start_dist(gen);
+            for (int i = 0; i < scan_length && workload.get_length() < total_requests; ++i)
+            {
+                workload.append_element((start + i) % key_space);
+            }
+        }
+        else
+        {
+            workload.append_element(zipf(gen));
+        }
+    }
+
+    return workload;
+}
+
+inline array_sequence<int> generate_loop_workload(int total_requests, int loop_length, int loop_start = 0)
+{
+    array_sequence<int> workload;
+
+    for (int i = 0; i < total_requests; ++i)
+    {
+        workload.append_element(loop_start + i % loop_length);
+    }
+
+    return workload;
+}
+
+inline array_sequence<int> generate_shifting_workload(int total_requests, int key_space, int hot_set_size,
+                                                      int shift_interval, double hot_probability, unsigned seed = 123)
+{
+    array_sequence<int> workload;
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<> prob_dist(0.0, 1.0);
+    std::uniform_int_distribution<> key_dist(0, key_space - 1);
+    std::uniform_int_distribution<> hot_dist(0, hot_set_size - 1);
+
+    int hot_start = 0;
+    for (int i = 0; i < total_requests; ++i)
+    {
+        if (i > 0 && i % shift_interval == 0)
+        {
+            hot_start = key_dist(gen);
+        }
+
+        if (prob_dist(gen) < hot_probability)
+        {
+            workload.append_element((hot_start + hot_dist(gen)) % key_space);
+        }
+        else
+        {
+            workload.append_element(key_dist(gen));
+        }
+    }
+
     return workload;
 }
\ No newline at end of file
@@ -2,20 +2,76 @@
 
 #include "hash_table/hash.hpp"
 #include "file_stream/file_stream.hpp"
+#include "file_stream/positional_reader.hpp"
+#include "file_stream/partitioned_store.hpp"
+#include "file_stream/slab_cache.hpp"
+#include "file_stream/wal_stream.hpp"
+#include "timing_wheel.hpp"
+#include "mrc_estimator.hpp"
+#include "read_ahead.hpp"
+#include "sketch/count_min_sketch.hpp"
+#include "trace/trace_writer.hpp"
+#include <future>
+#include <mutex>
+#include <type_traits>
 
 template <typename t_key, typename t_value>
 class cache
 {
 private:
+    static constexpr int expire_batch = 8;
+    static constexpr int eviction_window = 8;
+    static constexpr int scan_batch = 1024;
+    static constexpr int speculative_share = 4;
+
+    struct demotion
+    {
+        t_key key;
+        t_value value;
+        bool erased;
+    };
+
     hash_table<t_key, t_value> table;
     file_stream<entry<t_key, t_value>> stream;
+    positional_reader<entry<t_key, t_value>> backing;
 
     array_sequence<t_key> access_order;
+    timing_wheel<t_key> expirations;
+    std::function<int64_t()> clock;
 
-    int capacity;
+    mrc_estimator<t_key> miss_curve;
+    read_ahead prefetcher;
+    hash_table<t_key, bool> speculative;
+    hash_table<t_key, int> newest_positions;
+    array_sequence<t_key> speculative_order;
+    hash_table<t_key, double> miss_costs;
+    count_min_sketch<t_key> frequencies;
+    hash_table<t_key, std::shared_future<t_value>> in_flight;
+    std::function<int64_t(const t_key &, const t_value &)> weigher;
+    trace_writer<t_key, t_value> *trace;
+    partitioned_store<t_key, t_value> *store;
+    slab_cache<t_key, t_value> *victims;
+    array_sequence<demotion> demotions;
+    wal_stream<entry<t_key, t_value>> *log;
+
+    int64_t default_ttl;
+    int64_t max_weight;
+    int64_t total_weight;
+    double mean_miss_cost;
+    int cost_samples;
+    bool cost_aware;
     int hit_count;
     int miss_count;
+    int coalesced_count;
+    int promoted_count;
+    int prefetched_count;
     int hot_keys;
+    uint32_t admit_frequency;
+    int64_t frequency_window;
+
+    mutable std::mutex state_mutex;
+    std::mutex stream_mutex;
+    std::mutex tier_mutex;
 
 public:
     cache(int cap, int hot_keys, const std::function<int(const t_key&)> &hash_func, const std::string &stream_path);
@@ -23,20 +79,64 @@ public:
 
     t_value get(const t_key &key);
 
+    template <typename t_func>
+    std::invoke_result_t<t_func &, const t_value &> visit(const t_key &key, t_func reader);
+
     void put(const t_key &key, const t_value &value);
+    void put(const t_key &key, const t_value &value, int64_t ttl_ms);
     void reset_statistics();
+    void set_default_ttl(int64_t ttl_ms);
+    void set_clock(const std::function<int64_t()> &clock_func);
+    void set_weigher(const std::function<int64_t(const t_key &, const t_value &)> &weigher_func, int64_t max_weight);
+    void set_cost_aware(bool enabled);
+    void set_trace(trace_writer<t_key, t_value> *writer);
+    void set_backing_store(partitioned_store<t_key, t_value> *backing_store);
+    void set_victim_tier(slab_cache<t_key, t_value> *tier);
+    void set_write_ahead_log(wal_stream<entry<t_key, t_value>> *write_ahead_log);
+    void checkpoint();
+    void enable_frequency_admission(uint32_t min_frequency, int width = 4096, int depth = 4);
+    void enable_miss_ratio_curve(double sampling_rate = 0.01, int64_t bin_width = 1, int max_samples = 0);
+    void enable_read_ahead(int max_depth = 32, int max_stride = 16);
 
     int get_hit_count() const;
     int get_miss_count() const;
+    int get_coalesced_count() const;
+    int get_promoted_count() const;
+    int get_prefetched_count() const;
+    int64_t get_read_ahead_hit_count() const;
     int get_size() const;
+    int64_t get_weight() const;
 
     double get_hit_ratio() const;
+    double estimate_miss_ratio(int64_t capacity) const;
+
+    array_sequence<double> get_miss_ratio_curve(const array_sequence<int64_t> &capacities) const;
 
 private:
+    uint64_t put_locked(const t_key &key, const t_value &value, int64_t ttl_ms);
+    void insert_entry(const t_key &key, const t_value &value, int64_t ttl_ms, double cost);
+    void update_entry(const t_key &key, const t_value &value, int64_t ttl_ms);
+    bool insert_speculative(const t_key &key, const t_value &value, int64_t position);
+    void prefetch(int64_t position, int64_t stride, int count);
+    void settle_speculative(const t_key &key, bool used);
+    bool forget_speculative(const t_key &key);
     void update_access_order(const t_key &key);
+    void evict_if_needed(int fresh_speculative = 0);
+    void record_miss_cost(double cost);
+    void record_frequency(const t_key &key);
+    void schedule_expiration(const t_key &key, int64_t ttl_ms);
+    void expire_entries();
+    void remove_entry(const t_key &key);
     void write_to_stream(const t_key &key, const t_value &value);
+    void demote_evicted();
+
+    bool read_from_stream(const t_key &key, t_value &value, int64_t &position);
+
+    bool admits(const t_key &key) const;
+    bool is_demoting(const t_key &key) const;
 
-    bool read_from_stream(const t_key &key, t_value &value);
+    int select_victim() const;
+    double entry_cost(const t_key &key) const;
 
 };
 
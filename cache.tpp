@@ -1,92 +1,633 @@
 #include "cache.hpp"
+#include <chrono>
+#include <exception>
 #include <stdexcept>
+#include <vector>
 
 template <typename t_key, typename t_value>
 cache<t_key, t_value>::cache(int cap, int hot_keys, const std::function<int(const t_key&)> &hash_func, const std::string &stream_path)
-    : table(hash_func, cap*4), stream(stream_path), capacity(cap), hot_keys(hot_keys), hit_count(0), miss_count(0)
+    : table(hash_func, cap*4), stream(stream_path), backing(stream_path), expirations(hash_func, steady_clock_ms()), clock(steady_clock_ms),
+      miss_curve(hash_func), speculative(hash_func), newest_positions(hash_func), miss_costs(hash_func), frequencies(hash_func, 1, 1), in_flight(hash_func), weigher([](const t_key &, const t_value &) { return int64_t(1); }), trace(nullptr), store(nullptr), victims(nullptr), log(nullptr),
+      default_ttl(0), max_weight(cap), total_weight(0), mean_miss_cost(0.0), cost_samples(0), cost_aware(false),
+      hit_count(0), miss_count(0), coalesced_count(0), promoted_count(0), prefetched_count(0), hot_keys(hot_keys),
+      admit_frequency(0), frequency_window(0)
 {
     if (cap <= 0)
     {
         throw std::invalid_argument("Cache capacity must be positive");
     }
+    stream.move_position(backing.get_count());
 }
 
 template <typename t_key, typename t_value>
 t_value cache<t_key, t_value>::get(const t_key &key)
 {
+    return visit(key, [](const t_value &value) { return value; });
+}
+
+template <typename t_key, typename t_value>
+template <typename t_func>
+std::invoke_result_t<t_func &, const t_value &> cache<t_key, t_value>::visit(const t_key &key, t_func reader)
+{
+    std::unique_lock<std::mutex> lock(state_mutex);
+    if (trace)
+    {
+        trace->record_get(key);
+    }
+    if (admit_frequency > 0)
+    {
+        record_frequency(key);
+    }
+
+    expire_entries();
+    if (table.contains_key(key) && expirations.is_expired(key, expirations.get_time()))
+    {
+        this->remove_entry(key);
+    }
+
     if (table.contains_key(key))
     {
         hit_count++;
+        this->settle_speculative(key, true);
         this->update_access_order(key);
-        return table.get(key);
+        const t_value &value = table.get(key);
+        if (miss_curve.is_enabled())
+        {
+            miss_curve.access(key, weigher(key, value));
+        }
+        return reader(value);
+    }
+
+    miss_count++;
+    if (in_flight.contains_key(key))
+    {
+        coalesced_count++;
+        std::shared_future<t_value> pending = in_flight.get(key);
+        lock.unlock();
+        return reader(pending.get());
+    }
+
+    std::promise<t_value> loaded;
+    std::shared_future<t_value> result = loaded.get_future().share();
+    in_flight.set(key, result);
+    bool demoting = is_demoting(key);
+    lock.unlock();
+
+    t_value value;
+    bool found = false;
+    bool promoted = false;
+    int64_t position = -1;
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        promoted = victims && !demoting && victims->find(key, value);
+        found = promoted || this->read_from_stream(key, value, position);
+    }
+    catch (...)
+    {
+        lock.lock();
+        in_flight.erase(key);
+        loaded.set_exception(std::current_exception());
+        throw;
+    }
+    double cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    lock.lock();
+    in_flight.erase(key);
+    if (!found)
+    {
+        std::exception_ptr error = std::make_exception_ptr(std::out_of_range("Key not found in cache or backing store"));
+        loaded.set_exception(error);
+        std::rethrow_exception(error);
+    }
+
+    this->record_miss_cost(cost);
+    if (table.contains_key(key))
+    {
+        value = table.get(key);
     }
     else
     {
-        miss_count++;
-        t_value value;
-        if (this->read_from_stream(key, value))
+        if (miss_curve.is_enabled())
         {
-            if (key < hot_keys)
-            {
-                table.add(key, value);
-                this->update_access_order(key);
-            }
-            return value;
+            miss_curve.access(key, weigher(key, value));
+        }
+        if (promoted)
+        {
+            promoted_count++;
         }
-        else
+        if (promoted || admits(key))
         {
-            throw std::out_of_range("Key not found in cache or backing store");
+            this->insert_entry(key, value, default_ttl, cost);
         }
     }
+
+    int64_t stride = 0;
+    int count = 0;
+    bool ahead = position >= 0 && prefetcher.on_miss(position, stride, count);
+    loaded.set_value(std::move(value));
+    lock.unlock();
+
+    this->demote_evicted();
+    if (ahead)
+    {
+        this->prefetch(position, stride, count);
+    }
+    return reader(result.get());
 }
 
 template <typename t_key, typename t_value>
 void cache<t_key, t_value>::put(const t_key &key, const t_value &value)
 {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    wal_stream<entry<t_key, t_value>> *durable_log = log;
+    uint64_t sequence = put_locked(key, value, default_ttl);
+    lock.unlock();
+
+    demote_evicted();
+    if (durable_log)
+    {
+        durable_log->wait_durable(sequence);
+    }
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::put(const t_key &key, const t_value &value, int64_t ttl_ms)
+{
+    if (ttl_ms < 0)
+    {
+        throw std::invalid_argument("TTL must be non-negative");
+    }
+
+    std::unique_lock<std::mutex> lock(state_mutex);
+    wal_stream<entry<t_key, t_value>> *durable_log = log;
+    uint64_t sequence = put_locked(key, value, ttl_ms);
+    lock.unlock();
+
+    demote_evicted();
+    if (durable_log)
+    {
+        durable_log->wait_durable(sequence);
+    }
+}
+
+template <typename t_key, typename t_value>
+uint64_t cache<t_key, t_value>::put_locked(const t_key &key, const t_value &value, int64_t ttl_ms)
+{
+    if (trace)
+    {
+        trace->record_put(key, value);
+    }
+
+    expire_entries();
+    if (miss_curve.is_enabled())
+    {
+        miss_curve.access(key, weigher(key, value));
+    }
     if (table.contains_key(key))
     {
-        table.remove(key);
+        update_entry(key, value, ttl_ms);
+    }
+    else
+    {
+        insert_entry(key, value, ttl_ms, entry_cost(key));
+    }
+
+    if (victims)
+    {
+        demotions.append_element(demotion{key, value, true});
     }
-    table.add(key, value);
-    update_access_order(key);
 
+    uint64_t sequence = log ? log->append(entry<t_key, t_value>(key, value)) : 0;
     write_to_stream(key, value);
+    return sequence;
 }
 
 template <typename t_key, typename t_value>
 void cache<t_key, t_value>::reset_statistics()
 {
+    std::lock_guard<std::mutex> lock(state_mutex);
     hit_count = 0;
     miss_count = 0;
+    coalesced_count = 0;
+    promoted_count = 0;
+    prefetched_count = 0;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_default_ttl(int64_t ttl_ms)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    if (ttl_ms < 0)
+    {
+        throw std::invalid_argument("TTL must be non-negative");
+    }
+    default_ttl = ttl_ms;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_clock(const std::function<int64_t()> &clock_func)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    if (table.get_count() != 0)
+    {
+        throw std::logic_error("Clock must be set before entries are cached");
+    }
+    clock = clock_func;
+    expirations.reset(clock());
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_weigher(const std::function<int64_t(const t_key &, const t_value &)> &weigher_func, int64_t max_weight)
+{
+    std::unique_lock<std::mutex> lock(state_mutex);
+    if (max_weight <= 0)
+    {
+        throw std::invalid_argument("Cache weight limit must be positive");
+    }
+
+    weigher = weigher_func;
+    this->max_weight = max_weight;
+    total_weight = 0;
+    for (int i = 0; i < access_order.get_length(); ++i)
+    {
+        const t_key &key = access_order.get(i);
+        total_weight += weigher(key, table.get(key));
+    }
+    for (int i = 0; i < speculative_order.get_length(); ++i)
+    {
+        const t_key &key = speculative_order.get(i);
+        total_weight += weigher(key, table.get(key));
+    }
+    evict_if_needed();
+    lock.unlock();
+
+    demote_evicted();
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_cost_aware(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    cost_aware = enabled;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_trace(trace_writer<t_key, t_value> *writer)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    trace = writer;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_backing_store(partitioned_store<t_key, t_value> *backing_store)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    store = backing_store;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_victim_tier(slab_cache<t_key, t_value> *tier)
+{
+    std::lock_guard<std::mutex> lock(tier_mutex);
+    std::lock_guard<std::mutex> state_lock(state_mutex);
+    victims = tier;
+    demotions.clear();
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::set_write_ahead_log(wal_stream<entry<t_key, t_value>> *write_ahead_log)
+{
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        log = write_ahead_log;
+        if (log == nullptr)
+        {
+            return;
+        }
+
+        if (store == nullptr)
+        {
+            std::lock_guard<std::mutex> stream_lock(stream_mutex);
+            stream.truncate_partial();
+        }
+        log->replay([this](const entry<t_key, t_value> &item)
+        {
+            this->write_to_stream(item.key, item.value);
+        });
+    }
+    checkpoint();
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::checkpoint()
+{
+    std::unique_lock<std::mutex> lock(state_mutex);
+    wal_stream<entry<t_key, t_value>> *durable_log = log;
+    partitioned_store<t_key, t_value> *durable_store = store;
+    if (durable_log == nullptr)
+    {
+        return;
+    }
+    uint64_t sequence = durable_log->get_last_sequence();
+    lock.unlock();
+
+    durable_log->wait_durable(sequence);
+    if (durable_store)
+    {
+        durable_store->sync();
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> stream_lock(stream_mutex);
+            stream.reset();
+        }
+        backing.sync();
+    }
+    durable_log->checkpoint(sequence);
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::enable_frequency_admission(uint32_t min_frequency, int width, int depth)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    frequencies.resize(width, depth);
+    admit_frequency = min_frequency;
+    frequency_window = int64_t(width) * 8;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::enable_miss_ratio_curve(double sampling_rate, int64_t bin_width, int max_samples)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    miss_curve.reset(sampling_rate, bin_width, max_samples);
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::enable_read_ahead(int max_depth, int max_stride)
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    prefetcher.reset(max_depth, max_stride);
+
+    newest_positions.filter([](const int &) { return false; });
+    if (!prefetcher.is_enabled() || store)
+    {
+        return;
+    }
+
+    std::vector<entry<t_key, t_value>> batch(scan_batch);
+    int count = backing.get_count();
+    for (int first = 0; first < count; first += scan_batch)
+    {
+        int read = backing.read_range(first, batch.data(), count - first < scan_batch ? count - first : scan_batch);
+        for (int i = 0; i < read; i++)
+        {
+            newest_positions.set(batch[i].key, first + i);
+        }
+    }
 }
 
 template <typename t_key, typename t_value>
 int cache<t_key, t_value>::get_hit_count() const
 {
+    std::lock_guard<std::mutex> lock(state_mutex);
     return hit_count;
 }
 
 template <typename t_key, typename t_value>
 int cache<t_key, t_value>::get_miss_count() const
 {
+    std::lock_guard<std::mutex> lock(state_mutex);
     return miss_count;
 }
 
+template <typename t_key, typename t_value>
+int cache<t_key, t_value>::get_coalesced_count() const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return coalesced_count;
+}
+
+template <typename t_key, typename t_value>
+int cache<t_key, t_value>::get_promoted_count() const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return promoted_count;
+}
+
+template <typename t_key, typename t_value>
+int cache<t_key, t_value>::get_prefetched_count() const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return prefetched_count;
+}
+
+template <typename t_key, typename t_value>
+int64_t cache<t_key, t_value>::get_read_ahead_hit_count() const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return prefetcher.get_useful_count();
+}
+
 template <typename t_key, typename t_value>
 int cache<t_key, t_value>::get_size() const
 {
+    std::lock_guard<std::mutex> lock(state_mutex);
     return table.get_count();
 }
 
+template <typename t_key, typename t_value>
+int64_t cache<t_key, t_value>::get_weight() const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return total_weight;
+}
+
 template <typename t_key, typename t_value>
 double cache<t_key, t_value>::get_hit_ratio() const
 {
+    std::lock_guard<std::mutex> lock(state_mutex);
     int total = hit_count + miss_count;
     if (total == 0)
         return 0.0;
     return static_cast<double>(hit_count) / total;
 }
 
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::insert_entry(const t_key &key, const t_value &value, int64_t ttl_ms, double cost)
+{
+    int64_t weight = weigher(key, value);
+    if (weight > max_weight)
+    {
+        return;
+    }
+
+    table.add(key, value);
+    total_weight += weight;
+    if (cost_aware)
+    {
+        miss_costs.set(key, cost);
+    }
+    schedule_expiration(key, ttl_ms);
+    update_access_order(key);
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::update_entry(const t_key &key, const t_value &value, int64_t ttl_ms)
+{
+    int64_t weight = weigher(key, value);
+    if (weight > max_weight)
+    {
+        remove_entry(key);
+        return;
+    }
+
+    total_weight += weight - weigher(key, table.get(key));
+    table.insert_or_assign(key, value);
+    forget_speculative(key);
+    schedule_expiration(key, ttl_ms);
+    update_access_order(key);
+}
+
+template <typename t_key, typename t_value>
+bool cache<t_key, t_value>::insert_speculative(const t_key &key, const t_value &value, int64_t position)
+{
+    int64_t weight = weigher(key, value);
+    if (table.contains_key(key) || in_flight.contains_key(key) || weight > max_weight || !admits(key))
+    {
+        return false;
+    }
+    if (!newest_positions.contains_key(key) || newest_positions.get(key) != position ||
+        is_demoting(key) || (victims && victims->contains_key(key)))
+    {
+        return false;
+    }
+
+    table.add(key, value);
+    total_weight += weight;
+    speculative.set(key, true);
+    speculative_order.append_element(key);
+    schedule_expiration(key, default_ttl);
+    prefetched_count++;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::prefetch(int64_t position, int64_t stride, int count)
+{
+    int64_t first = stride > 0 ? position + stride : position + stride * count;
+    int64_t last = stride > 0 ? position + stride * count : position + stride;
+    first = first < 0 ? 0 : first;
+    if (last < first)
+    {
+        return;
+    }
+
+    std::vector<entry<t_key, t_value>> block(static_cast<size_t>(last - first + 1));
+    int read = 0;
+    try
+    {
+        read = backing.read_range(static_cast<int>(first), block.data(), static_cast<int>(block.size()));
+    }
+    catch (const std::runtime_error &)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        int64_t budget = max_weight - total_weight;
+        for (int i = 0; i < speculative_order.get_length(); ++i)
+        {
+            const t_key &key = speculative_order.get(i);
+            budget += weigher(key, table.get(key));
+        }
+        budget = budget > max_weight / speculative_share ? budget : max_weight / speculative_share;
+
+        int reach = 0;
+        for (int k = 1; k <= count; k++)
+        {
+            int64_t offset = position + stride * k - first;
+            if (offset < 0 || offset >= read)
+            {
+                continue;
+            }
+            int64_t weight = weigher(block[offset].key, block[offset].value);
+            if (weight > budget)
+            {
+                break;
+            }
+            budget -= weight;
+            reach = k;
+        }
+
+        int inserted = 0;
+        for (int k = reach; k >= 1; k--)
+        {
+            int64_t offset = position + stride * k - first;
+            if (offset >= 0 && offset < read && insert_speculative(block[offset].key, block[offset].value, first + offset))
+            {
+                inserted++;
+            }
+        }
+        evict_if_needed(inserted);
+    }
+    demote_evicted();
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::settle_speculative(const t_key &key, bool used)
+{
+    if (!forget_speculative(key))
+    {
+        return;
+    }
+
+    if (used)
+    {
+        prefetcher.record_useful();
+    }
+    else
+    {
+        prefetcher.record_wasted();
+    }
+}
+
+template <typename t_key, typename t_value>
+bool cache<t_key, t_value>::forget_speculative(const t_key &key)
+{
+    if (!speculative.contains_key(key))
+    {
+        return false;
+    }
+
+    speculative.erase(key);
+    for (int i = 0; i < speculative_order.get_length(); ++i)
+    {
+        if (speculative_order.get(i) == key)
+        {
+            speculative_order.remove_at(i);
+            break;
+        }
+    }
+    return true;
+}
+
+template <typename t_key, typename t_value>
+double cache<t_key, t_value>::estimate_miss_ratio(int64_t capacity) const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return miss_curve.miss_ratio(capacity);
+}
+
+template <typename t_key, typename t_value>
+array_sequence<double> cache<t_key, t_value>::get_miss_ratio_curve(const array_sequence<int64_t> &capacities) const
+{
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return miss_curve.curve(capacities);
+}
+
 template <typename t_key, typename t_value>
 void cache<t_key, t_value>::update_access_order(const t_key &key)
 {
@@ -101,43 +642,243 @@ void cache<t_key, t_value>::update_access_order(const t_key &key)
 
     access_order.append_element(key);
 
-    while (access_order.get_length() > capacity)
+    evict_if_needed();
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::evict_if_needed(int fresh_speculative)
+{
+    while (total_weight > max_weight && speculative_order.get_length() > fresh_speculative)
+    {
+        t_key victim = speculative_order.get(0);
+        remove_entry(victim);
+    }
+    while (total_weight > max_weight && access_order.get_length() > 0)
+    {
+        t_key victim = access_order.get(select_victim());
+        if (victims)
+        {
+            demotions.append_element(demotion{victim, table.get(victim), false});
+        }
+        remove_entry(victim);
+    }
+    while (total_weight > max_weight && speculative_order.get_length() > 0)
+    {
+        remove_entry(speculative_order.get(0));
+    }
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::record_miss_cost(double cost)
+{
+    if (!cost_aware)
+    {
+        return;
+    }
+
+    cost_samples++;
+    mean_miss_cost += (cost - mean_miss_cost) / cost_samples;
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::record_frequency(const t_key &key)
+{
+    frequencies.add(key);
+    if (frequencies.get_total() >= frequency_window)
+    {
+        frequencies.halve();
+    }
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::schedule_expiration(const t_key &key, int64_t ttl_ms)
+{
+    if (ttl_ms > 0)
+    {
+        expirations.schedule(key, expirations.get_time() + ttl_ms);
+    }
+    else
+    {
+        expirations.cancel(key);
+    }
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::expire_entries()
+{
+    expirations.advance(clock());
+    expirations.expire(expire_batch, [this](const t_key &key)
+    {
+        this->remove_entry(key);
+    });
+}
+
+template <typename t_key, typename t_value>
+void cache<t_key, t_value>::remove_entry(const t_key &key)
+{
+    if (!table.contains_key(key))
+    {
+        return;
+    }
+
+    total_weight -= weigher(key, table.get(key));
+    table.remove(key);
+    settle_speculative(key, false);
+    miss_costs.del(key);
+    expirations.cancel(key);
+    for (int i = 0; i < access_order.get_length(); ++i)
     {
-        t_key oldest_key = access_order.get(0);
-        table.remove(oldest_key);
-        access_order.remove_at(0);
+        if (access_order.get(i) == key)
+        {
+            access_order.remove_at(i);
+            break;
+        }
     }
 }
 
 template <typename t_key, typename t_value>
 void cache<t_key, t_value>::write_to_stream(const t_key &key, const t_value &value)
 {
+    if (store)
+    {
+        store->write(key, value);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(stream_mutex);
+    if (prefetcher.is_enabled())
+    {
+        newest_positions.set(key, stream.get_current_pos());
+    }
     stream.write(entry<t_key, t_value>(key, value));
+    stream.reset();
 }
 
 template <typename t_key, typename t_value>
-bool cache<t_key, t_value>::read_from_stream(const t_key &key, t_value &value)
+void cache<t_key, t_value>::demote_evicted()
 {
-    stream.move_position(0);
+    std::lock_guard<std::mutex> tier_lock(tier_mutex);
+    std::unique_lock<std::mutex> lock(state_mutex);
+    slab_cache<t_key, t_value> *tier = victims;
+    array_sequence<demotion> batch = demotions;
+    lock.unlock();
+
+    if (tier == nullptr || batch.get_length() == 0)
+    {
+        return;
+    }
 
+    std::exception_ptr error;
     try
     {
-        while (true)
+        for (int i = 0; i < batch.get_length(); ++i)
         {
-            auto entry_data = stream.read();
-            if (entry_data.key == key)
+            if (batch[i].erased)
+            {
+                tier->erase(batch[i].key);
+            }
+            else
             {
-                value = entry_data.value;
+                tier->store(batch[i].key, batch[i].value);
+            }
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+        tier->clear();
+    }
+
+    lock.lock();
+    array_sequence<demotion> rest;
+    for (int i = batch.get_length(); i < demotions.get_length(); ++i)
+    {
+        rest.append_element(demotions.get(i));
+    }
+    demotions = rest;
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+template <typename t_key, typename t_value>
+bool cache<t_key, t_value>::read_from_stream(const t_key &key, t_value &value, int64_t &position)
+{
+    if (store)
+    {
+        return store->find(key, value);
+    }
+
+    std::vector<entry<t_key, t_value>> batch(scan_batch);
+    for (int end = backing.get_count(); end > 0; end -= scan_batch)
+    {
+        int first = end > scan_batch ? end - scan_batch : 0;
+        int read = backing.read_range(first, batch.data(), end - first);
+        for (int i = read - 1; i >= 0; i--)
+        {
+            if (batch[i].key == key)
+            {
+                value = batch[i].value;
+                position = first + i;
                 return true;
             }
         }
     }
-    catch (const std::out_of_range &)
+    return false;
+}
+
+
+template <typename t_key, typename t_value>
+bool cache<t_key, t_value>::admits(const t_key &key) const
+{
+    if (admit_frequency > 0)
     {
-        return false;
+        return frequencies.estimate(key) >= admit_frequency;
     }
-    catch (...)
+    return key < hot_keys;
+}
+
+template <typename t_key, typename t_value>
+bool cache<t_key, t_value>::is_demoting(const t_key &key) const
+{
+    for (int i = 0; i < demotions.get_length(); ++i)
     {
-        return false; 
+        if (demotions.get(i).key == key)
+        {
+            return true;
+        }
     }
+    return false;
+}
+
+template <typename t_key, typename t_value>
+int cache<t_key, t_value>::select_victim() const
+{
+    if (!cost_aware)
+    {
+        return 0;
+    }
+
+    int window = access_order.get_length() < eviction_window ? access_order.get_length() : eviction_window;
+    int victim = 0;
+    double victim_score = 0.0;
+    for (int i = 0; i < window; ++i)
+    {
+        const t_key &key = access_order.get(i);
+        int64_t weight = weigher(key, table.get(key));
+        double score = entry_cost(key) / (weight > 0 ? weight : 1);
+        if (i == 0 || score < victim_score)
+        {
+            victim = i;
+            victim_score = score;
+        }
+    }
+    return victim;
+}
+
+template <typename t_key, typename t_value>
+double cache<t_key, t_value>::entry_cost(const t_key &key) const
+{
+    return miss_costs.contains_key(key) ? miss_costs.get(key) : mean_miss_cost;
 }
\ No newline at end of file
@@ -26,6 +26,7 @@ public:
     void reset() override;
     void close() override;
     void from_sequence(const array_sequence<T> &seq);
+    int truncate_partial();
 
     int get_current_pos() const override;
 
@@ -1,4 +1,5 @@
 #include "file_stream.hpp"
+#include <filesystem>
 #include <stdexcept>
 
 template<typename T>
@@ -124,6 +125,30 @@ void file_stream<T>::from_sequence(const array_sequence<T> &seq)
     }
 }
 
+template<typename T>
+int file_stream<T>::truncate_partial()
+{
+    close();
+    std::error_code error;
+    std::uintmax_t size = std::filesystem::file_size(file_path, error);
+    if (error)
+    {
+        throw std::runtime_error("Cannot stat file: " + file_path);
+    }
+
+    std::uintmax_t whole = size - size % sizeof(T);
+    if (whole != size)
+    {
+        std::filesystem::resize_file(file_path, whole, error);
+        if (error)
+        {
+            throw std::runtime_error("Cannot truncate file: " + file_path);
+        }
+    }
+    move_position(static_cast<int>(whole / sizeof(T)));
+    return static_cast<int>(size - whole);
+}
+
 template<typename T>
 void file_stream<T>::open_file()
 {
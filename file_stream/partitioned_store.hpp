@@ -0,0 +1,54 @@
+#pragma once
+
+#include "file_stream.hpp"
+#include "positional_reader.hpp"
+#include "../hash_table/entry.hpp"
+#include "../hash_table/run_parallel.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+template <typename t_key, typename t_value>
+class partitioned_store
+{
+private:
+    static constexpr int scan_batch = 1024;
+
+    array_sequence<std::string> paths;
+    array_sequence<t_key> split_keys;
+    array_sequence<file_stream<entry<t_key, t_value>> *> writers;
+    array_sequence<positional_reader<entry<t_key, t_value>> *> readers;
+    std::vector<std::mutex> write_mutexes;
+
+    std::function<int(const t_key &)> hash_function;
+
+public:
+    partitioned_store(const array_sequence<std::string> &paths, const std::function<int(const t_key &)> &hash_function);
+    partitioned_store(const array_sequence<std::string> &paths, const array_sequence<t_key> &split_keys);
+    ~partitioned_store();
+
+    partitioned_store(const partitioned_store &) = delete;
+    partitioned_store &operator=(const partitioned_store &) = delete;
+
+    int get_partition_count() const;
+    int get_count() const;
+    int get_count(int partition) const;
+    int partition_of(const t_key &key) const;
+
+    void write(const t_key &key, const t_value &value);
+    void load(const array_sequence<entry<t_key, t_value>> &entries);
+
+    bool find(const t_key &key, t_value &value) const;
+    void sync();
+
+    template <typename t_func>
+    void scan(t_func func) const;
+
+private:
+    void open_partitions();
+    void append(int partition, const entry<t_key, t_value> *items, int count);
+};
+
+#include "partitioned_store.tpp"
\ No newline at end of file
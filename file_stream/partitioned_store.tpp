@@ -0,0 +1,197 @@
+#include "partitioned_store.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+partitioned_store<t_key, t_value>::partitioned_store(const array_sequence<std::string> &paths, const std::function<int(const t_key &)> &hash_func)
+    : paths(paths), write_mutexes(paths.get_length()), hash_function(hash_func)
+{
+    open_partitions();
+}
+
+template <typename t_key, typename t_value>
+partitioned_store<t_key, t_value>::partitioned_store(const array_sequence<std::string> &paths, const array_sequence<t_key> &split_keys)
+    : paths(paths), split_keys(split_keys), write_mutexes(paths.get_length())
+{
+    if (split_keys.get_length() != paths.get_length() - 1)
+    {
+        throw std::invalid_argument("Range partitioning needs one split key less than partitions");
+    }
+    for (int i = 1; i < split_keys.get_length(); i++)
+    {
+        if (!(split_keys.get(i - 1) < split_keys.get(i)))
+        {
+            throw std::invalid_argument("Split keys must be strictly increasing");
+        }
+    }
+    open_partitions();
+}
+
+template <typename t_key, typename t_value>
+partitioned_store<t_key, t_value>::~partitioned_store()
+{
+    for (int i = 0; i < readers.get_length(); i++)
+    {
+        delete readers[i];
+    }
+    for (int i = 0; i < writers.get_length(); i++)
+    {
+        delete writers[i];
+    }
+}
+
+template <typename t_key, typename t_value>
+int partitioned_store<t_key, t_value>::get_partition_count() const
+{
+    return paths.get_length();
+}
+
+template <typename t_key, typename t_value>
+int partitioned_store<t_key, t_value>::get_count() const
+{
+    int count = 0;
+    for (int i = 0; i < readers.get_length(); i++)
+    {
+        count += readers.get(i)->get_count();
+    }
+    return count;
+}
+
+template <typename t_key, typename t_value>
+int partitioned_store<t_key, t_value>::get_count(int partition) const
+{
+    if (partition < 0 || partition >= readers.get_length())
+    {
+        throw std::out_of_range("Partition index out of range");
+    }
+    return readers.get(partition)->get_count();
+}
+
+template <typename t_key, typename t_value>
+int partitioned_store<t_key, t_value>::partition_of(const t_key &key) const
+{
+    if (hash_function)
+    {
+        return static_cast<int>(static_cast<unsigned>(hash_function(key)) % static_cast<unsigned>(paths.get_length()));
+    }
+
+    int low = 0;
+    int high = split_keys.get_length();
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (key < split_keys.get(middle))
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+template <typename t_key, typename t_value>
+void partitioned_store<t_key, t_value>::write(const t_key &key, const t_value &value)
+{
+    entry<t_key, t_value> item(key, value);
+    append(partition_of(key), &item, 1);
+}
+
+template <typename t_key, typename t_value>
+void partitioned_store<t_key, t_value>::load(const array_sequence<entry<t_key, t_value>> &entries)
+{
+    std::vector<std::vector<entry<t_key, t_value>>> groups(paths.get_length());
+    for (int i = 0; i < entries.get_length(); i++)
+    {
+        const auto &item = entries.get(i);
+        groups[partition_of(item.key)].push_back(item);
+    }
+
+    run_parallel(paths.get_length(), paths.get_length(), [&](int partition)
+    {
+        append(partition, groups[partition].data(), static_cast<int>(groups[partition].size()));
+    });
+}
+
+template <typename t_key, typename t_value>
+bool partitioned_store<t_key, t_value>::find(const t_key &key, t_value &value) const
+{
+    const positional_reader<entry<t_key, t_value>> *reader = readers.get(partition_of(key));
+    std::vector<entry<t_key, t_value>> batch(scan_batch);
+    for (int end = reader->get_count(); end > 0; end -= scan_batch)
+    {
+        int first = end > scan_batch ? end - scan_batch : 0;
+        int read = reader->read_range(first, batch.data(), end - first);
+        for (int i = read - 1; i >= 0; i--)
+        {
+            if (batch[i].key == key)
+            {
+                value = batch[i].value;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename t_key, typename t_value>
+void partitioned_store<t_key, t_value>::sync()
+{
+    for (int i = 0; i < writers.get_length(); i++)
+    {
+        {
+            std::lock_guard<std::mutex> lock(write_mutexes[i]);
+            writers[i]->reset();
+        }
+        readers[i]->sync();
+    }
+}
+
+template <typename t_key, typename t_value>
+template <typename t_func>
+void partitioned_store<t_key, t_value>::scan(t_func func) const
+{
+    run_parallel(paths.get_length(), paths.get_length(), [&](int partition)
+    {
+        const positional_reader<entry<t_key, t_value>> *reader = readers.get(partition);
+        std::vector<entry<t_key, t_value>> batch(scan_batch);
+        int count = reader->get_count();
+        for (int first = 0; first < count; first += scan_batch)
+        {
+            int read = reader->read_range(first, batch.data(), count - first < scan_batch ? count - first : scan_batch);
+            for (int i = 0; i < read; i++)
+            {
+                func(partition, batch[i]);
+            }
+        }
+    });
+}
+
+template <typename t_key, typename t_value>
+void partitioned_store<t_key, t_value>::open_partitions()
+{
+    if (paths.get_length() == 0)
+    {
+        throw std::invalid_argument("Partitioned store needs at least one partition");
+    }
+
+    for (int i = 0; i < paths.get_length(); i++)
+    {
+        writers.append_element(new file_stream<entry<t_key, t_value>>(paths.get(i)));
+        readers.append_element(new positional_reader<entry<t_key, t_value>>(paths.get(i)));
+    }
+}
+
+template <typename t_key, typename t_value>
+void partitioned_store<t_key, t_value>::append(int partition, const entry<t_key, t_value> *items, int count)
+{
+    std::lock_guard<std::mutex> lock(write_mutexes[partition]);
+    file_stream<entry<t_key, t_value>> *writer = writers[partition];
+    writer->move_position(readers[partition]->get_count());
+    for (int i = 0; i < count; i++)
+    {
+        writer->write(items[i]);
+    }
+    writer->reset();
+}
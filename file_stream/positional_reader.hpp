@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <mutex>
+#endif
+
+template <typename T>
+class positional_reader
+{
+private:
+    std::string file_path;
+
+#if defined(_WIN32)
+    mutable std::ifstream file;
+    mutable std::mutex file_mutex;
+#else
+    int descriptor;
+#endif
+
+public:
+    explicit positional_reader(const std::string &path);
+    ~positional_reader();
+
+    positional_reader(const positional_reader &) = delete;
+    positional_reader &operator=(const positional_reader &) = delete;
+
+    bool read_at(int index, T &item) const;
+    int read_range(int first, T *items, int count) const;
+
+    int get_count() const;
+    void sync() const;
+
+private:
+    long long read_bytes(long long offset, char *buffer, long long size) const;
+};
+
+#include "positional_reader.tpp"
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "positional_reader.hpp"
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+template <typename T>
+positional_reader<T>::positional_reader(const std::string &path)
+    : file_path(path)
+{
+#if defined(_WIN32)
+    file.open(path, std::ios::binary | std::ios::in);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+#else
+    descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor == -1)
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+#endif
+}
+
+template <typename T>
+positional_reader<T>::~positional_reader()
+{
+#if !defined(_WIN32)
+    close(descriptor);
+#endif
+}
+
+template <typename T>
+bool positional_reader<T>::read_at(int index, T &item) const
+{
+    return read_range(index, &item, 1) == 1;
+}
+
+template <typename T>
+int positional_reader<T>::read_range(int first, T *items, int count) const
+{
+    if (first < 0 || count < 0)
+    {
+        throw std::out_of_range("Position out of bounds");
+    }
+
+    long long size = static_cast<long long>(count) * sizeof(T);
+    long long done = read_bytes(static_cast<long long>(first) * sizeof(T), reinterpret_cast<char *>(items), size);
+    if (done % sizeof(T) != 0)
+    {
+        throw std::runtime_error("Incomplete read");
+    }
+    return static_cast<int>(done / sizeof(T));
+}
+
+template <typename T>
+int positional_reader<T>::get_count() const
+{
+#if defined(_WIN32)
+    std::lock_guard<std::mutex> lock(file_mutex);
+    file.clear();
+    file.seekg(0, std::ios::end);
+    return static_cast<int>(file.tellg() / sizeof(T));
+#else
+    struct stat info;
+    if (fstat(descriptor, &info) != 0)
+    {
+        throw std::runtime_error("Cannot stat file: " + file_path);
+    }
+    return static_cast<int>(info.st_size / sizeof(T));
+#endif
+}
+
+template <typename T>
+void positional_reader<T>::sync() const
+{
+#if defined(_WIN32)
+    throw std::runtime_error("File sync is not supported on this platform");
+#else
+    if (fsync(descriptor) != 0)
+    {
+        throw std::runtime_error("Cannot sync file: " + file_path);
+    }
+#endif
+}
+
+template <typename T>
+long long positional_reader<T>::read_bytes(long long offset, char *buffer, long long size) const
+{
+#if defined(_WIN32)
+    std::lock_guard<std::mutex> lock(file_mutex);
+    file.clear();
+    file.seekg(offset, std::ios::beg);
+    file.read(buffer, size);
+    return file.gcount();
+#else
+    long long done = 0;
+    while (done < size)
+    {
+        ssize_t result = pread(descriptor, buffer + done, static_cast<size_t>(size - done), static_cast<off_t>(offset + done));
+        if (result == 0)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Read error: " + file_path);
+        }
+        done += result;
+    }
+    return done;
+#endif
+}
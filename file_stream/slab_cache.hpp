@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../hash_table/entry.hpp"
+#include "../hash_table/hash.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#if defined(_WIN32)
+#include <fstream>
+#endif
+
+enum class slab_policy
+{
+    fifo,
+    clock
+};
+
+template <typename t_key, typename t_value>
+class slab_cache
+{
+private:
+    static constexpr uint8_t slot_free = 0;
+    static constexpr uint8_t slot_used = 1;
+    static constexpr uint8_t slot_referenced = 2;
+
+    std::string file_path;
+
+#if defined(_WIN32)
+    std::fstream file;
+#else
+    int descriptor;
+#endif
+
+    hash_table<t_key, int> index;
+    array_sequence<t_key> slot_keys;
+    array_sequence<uint8_t> slot_states;
+    array_sequence<int> free_slots;
+
+    slab_policy policy;
+    int capacity;
+    int hand;
+    int hit_count;
+    int miss_count;
+    int eviction_count;
+
+    mutable std::mutex slab_mutex;
+
+public:
+    slab_cache(const std::string &path, int slots, const std::function<int(const t_key &)> &hash_function, slab_policy policy = slab_policy::clock);
+    ~slab_cache();
+
+    slab_cache(const slab_cache &) = delete;
+    slab_cache &operator=(const slab_cache &) = delete;
+
+    bool find(const t_key &key, t_value &value);
+    void store(const t_key &key, const t_value &value);
+    void erase(const t_key &key);
+    void clear();
+
+    bool contains_key(const t_key &key) const;
+    int get_count() const;
+    int get_capacity() const;
+    int get_hit_count() const;
+    int get_miss_count() const;
+    int get_eviction_count() const;
+
+private:
+    int acquire_slot();
+    void release_slot(int slot);
+
+    void write_slot(int slot, const entry<t_key, t_value> &item);
+    void read_slot(int slot, entry<t_key, t_value> &item);
+};
+
+#include "slab_cache.tpp"
\ No newline at end of file
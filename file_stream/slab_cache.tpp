@@ -0,0 +1,267 @@
+#include "slab_cache.hpp"
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+template <typename t_key, typename t_value>
+slab_cache<t_key, t_value>::slab_cache(const std::string &path, int slots, const std::function<int(const t_key &)> &hash_function, slab_policy policy)
+    : file_path(path), index(hash_function), slot_keys(slots > 0 ? slots : 0), slot_states(slots > 0 ? slots : 0),
+      policy(policy), capacity(slots), hand(0), hit_count(0), miss_count(0), eviction_count(0)
+{
+    if (slots <= 0)
+    {
+        throw std::invalid_argument("Slab capacity must be positive");
+    }
+
+#if defined(_WIN32)
+    file.open(path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+#else
+    descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descriptor == -1)
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+    if (ftruncate(descriptor, static_cast<off_t>(slots) * sizeof(entry<t_key, t_value>)) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error("Cannot size file: " + file_path);
+    }
+#endif
+
+    index.reserve(slots);
+    for (int i = 0; i < slots; i++)
+    {
+        slot_states[i] = slot_free;
+        free_slots.append_element(slots - 1 - i);
+    }
+}
+
+template <typename t_key, typename t_value>
+slab_cache<t_key, t_value>::~slab_cache()
+{
+#if !defined(_WIN32)
+    close(descriptor);
+#endif
+}
+
+template <typename t_key, typename t_value>
+bool slab_cache<t_key, t_value>::find(const t_key &key, t_value &value)
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    if (!index.contains_key(key))
+    {
+        miss_count++;
+        return false;
+    }
+
+    int slot = index.get(key);
+    entry<t_key, t_value> item;
+    read_slot(slot, item);
+    if (!(item.key == key))
+    {
+        throw std::runtime_error("Corrupted slab slot: " + file_path);
+    }
+
+    slot_states[slot] = slot_referenced;
+    hit_count++;
+    value = item.value;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::store(const t_key &key, const t_value &value)
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    if (index.contains_key(key))
+    {
+        write_slot(index.get(key), entry<t_key, t_value>(key, value));
+        return;
+    }
+
+    int slot = acquire_slot();
+    try
+    {
+        write_slot(slot, entry<t_key, t_value>(key, value));
+    }
+    catch (...)
+    {
+        free_slots.append_element(slot);
+        throw;
+    }
+
+    slot_keys[slot] = key;
+    slot_states[slot] = slot_used;
+    index.set(key, slot);
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::erase(const t_key &key)
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    if (index.contains_key(key))
+    {
+        release_slot(index.get(key));
+    }
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::clear()
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    for (int i = 0; i < capacity; i++)
+    {
+        if (slot_states[i] != slot_free)
+        {
+            release_slot(i);
+        }
+    }
+    hand = 0;
+}
+
+template <typename t_key, typename t_value>
+bool slab_cache<t_key, t_value>::contains_key(const t_key &key) const
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    return index.contains_key(key);
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::get_count() const
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    return index.get_count();
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::get_capacity() const
+{
+    return capacity;
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::get_hit_count() const
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    return hit_count;
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::get_miss_count() const
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    return miss_count;
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::get_eviction_count() const
+{
+    std::lock_guard<std::mutex> lock(slab_mutex);
+    return eviction_count;
+}
+
+template <typename t_key, typename t_value>
+int slab_cache<t_key, t_value>::acquire_slot()
+{
+    if (free_slots.get_length() > 0)
+    {
+        int slot = free_slots.get(free_slots.get_length() - 1);
+        free_slots.remove_at(free_slots.get_length() - 1);
+        return slot;
+    }
+
+    while (policy == slab_policy::clock && slot_states[hand] == slot_referenced)
+    {
+        slot_states[hand] = slot_used;
+        hand = (hand + 1) % capacity;
+    }
+
+    int slot = hand;
+    hand = (hand + 1) % capacity;
+    index.erase(slot_keys[slot]);
+    slot_states[slot] = slot_free;
+    eviction_count++;
+    return slot;
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::release_slot(int slot)
+{
+    index.erase(slot_keys[slot]);
+    slot_states[slot] = slot_free;
+    free_slots.append_element(slot);
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::write_slot(int slot, const entry<t_key, t_value> &item)
+{
+    long long offset = static_cast<long long>(slot) * sizeof(entry<t_key, t_value>);
+    const char *buffer = reinterpret_cast<const char *>(&item);
+#if defined(_WIN32)
+    file.clear();
+    file.seekp(offset, std::ios::beg);
+    file.write(buffer, sizeof(entry<t_key, t_value>));
+    file.flush();
+    if (!file)
+    {
+        throw std::runtime_error("Write error: " + file_path);
+    }
+#else
+    size_t done = 0;
+    while (done < sizeof(entry<t_key, t_value>))
+    {
+        ssize_t result = pwrite(descriptor, buffer + done, sizeof(entry<t_key, t_value>) - done, static_cast<off_t>(offset + done));
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Write error: " + file_path);
+        }
+        done += result;
+    }
+#endif
+}
+
+template <typename t_key, typename t_value>
+void slab_cache<t_key, t_value>::read_slot(int slot, entry<t_key, t_value> &item)
+{
+    long long offset = static_cast<long long>(slot) * sizeof(entry<t_key, t_value>);
+    char *buffer = reinterpret_cast<char *>(&item);
+#if defined(_WIN32)
+    file.clear();
+    file.seekg(offset, std::ios::beg);
+    file.read(buffer, sizeof(entry<t_key, t_value>));
+    if (file.gcount() != static_cast<std::streamsize>(sizeof(entry<t_key, t_value>)))
+    {
+        throw std::runtime_error("Incomplete read");
+    }
+#else
+    size_t done = 0;
+    while (done < sizeof(entry<t_key, t_value>))
+    {
+        ssize_t result = pread(descriptor, buffer + done, sizeof(entry<t_key, t_value>) - done, static_cast<off_t>(offset + done));
+        if (result == 0)
+        {
+            throw std::runtime_error("Incomplete read");
+        }
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Read error: " + file_path);
+        }
+        done += result;
+    }
+#endif
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+class wal_stream
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Logged records must be trivially copyable");
+
+private:
+    static constexpr uint32_t frame_magic = 0x57414c31;
+    static constexpr int recovery_batch = 256;
+
+    struct frame_header
+    {
+        uint32_t magic;
+        uint32_t checksum;
+        uint64_t sequence;
+    };
+
+    static constexpr size_t frame_size = sizeof(frame_header) + sizeof(T);
+
+    std::string file_path;
+    int descriptor;
+
+    std::vector<char> pending;
+    std::vector<char> committing;
+
+    uint64_t next_sequence;
+    uint64_t durable_sequence;
+    long long end_offset;
+    long long durable_offset;
+
+    int commit_interval_us;
+    bool commit_running;
+    bool failed;
+
+    int64_t commit_count;
+    int64_t recovered_count;
+    long long truncated_bytes;
+
+    mutable std::mutex log_mutex;
+    std::condition_variable durable_changed;
+
+public:
+    explicit wal_stream(const std::string &path, int commit_interval_us = 0);
+    ~wal_stream();
+
+    wal_stream(const wal_stream &) = delete;
+    wal_stream &operator=(const wal_stream &) = delete;
+
+    uint64_t append(const T &item);
+    void wait_durable(uint64_t sequence);
+    void write(const T &item);
+    void flush();
+    void checkpoint(uint64_t sequence);
+
+    template <typename t_func>
+    int replay(t_func func) const;
+
+    int get_count() const;
+    uint64_t get_last_sequence() const;
+    int64_t get_commit_count() const;
+    int64_t get_recovered_count() const;
+    long long get_truncated_bytes() const;
+
+private:
+    void recover();
+    void commit_batch(std::unique_lock<std::mutex> &lock);
+
+    bool compact(long long first, long long limit);
+    bool write_bytes(long long offset, const char *buffer, size_t size);
+    long long read_bytes(long long offset, char *buffer, size_t size) const;
+
+    static bool write_all(int target, long long offset, const char *buffer, size_t size);
+    static bool decode(const char *frame, uint64_t expected_sequence, T &item);
+    static uint32_t checksum(uint64_t sequence, const char *data, size_t size);
+};
+
+#include "wal_stream.tpp"
\ No newline at end of file
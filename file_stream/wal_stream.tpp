@@ -0,0 +1,506 @@
+#include "wal_stream.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+template <typename T>
+wal_stream<T>::wal_stream(const std::string &path, int commit_interval_us)
+    : file_path(path), descriptor(-1), next_sequence(1), durable_sequence(0), end_offset(0), durable_offset(0),
+      commit_interval_us(commit_interval_us), commit_running(false), failed(false),
+      commit_count(0), recovered_count(0), truncated_bytes(0)
+{
+    if (commit_interval_us < 0)
+    {
+        throw std::invalid_argument("Commit interval must be non-negative");
+    }
+
+#if defined(_WIN32)
+    throw std::runtime_error("Write-ahead log is not supported on this platform");
+#else
+    descriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descriptor == -1)
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+
+    try
+    {
+        recover();
+    }
+    catch (...)
+    {
+        close(descriptor);
+        throw;
+    }
+#endif
+}
+
+template <typename T>
+wal_stream<T>::~wal_stream()
+{
+#if !defined(_WIN32)
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+    close(descriptor);
+#endif
+}
+
+template <typename T>
+uint64_t wal_stream<T>::append(const T &item)
+{
+    frame_header header{frame_magic, 0, 0};
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (failed)
+    {
+        throw std::runtime_error("Write error: " + file_path);
+    }
+
+    header.sequence = next_sequence++;
+    header.checksum = checksum(header.sequence, reinterpret_cast<const char *>(&item), sizeof(T));
+
+    size_t offset = pending.size();
+    pending.resize(offset + frame_size);
+    std::memcpy(pending.data() + offset, &header, sizeof(frame_header));
+    std::memcpy(pending.data() + offset + sizeof(frame_header), &item, sizeof(T));
+    return header.sequence;
+}
+
+template <typename T>
+void wal_stream<T>::wait_durable(uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(log_mutex);
+    if (sequence >= next_sequence)
+    {
+        throw std::invalid_argument("Sequence was never appended");
+    }
+    while (durable_sequence < sequence)
+    {
+        if (failed)
+        {
+            throw std::runtime_error("Write error: " + file_path);
+        }
+        if (commit_running)
+        {
+            durable_changed.wait(lock);
+        }
+        else
+        {
+            commit_batch(lock);
+        }
+    }
+}
+
+template <typename T>
+void wal_stream<T>::write(const T &item)
+{
+    wait_durable(append(item));
+}
+
+template <typename T>
+void wal_stream<T>::flush()
+{
+    uint64_t last;
+    {
+        std::lock_guard<std::mutex> lock(log_mutex);
+        last = next_sequence - 1;
+    }
+    wait_durable(last);
+}
+
+template <typename T>
+void wal_stream<T>::checkpoint(uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(log_mutex);
+    if (sequence >= next_sequence)
+    {
+        throw std::invalid_argument("Sequence was never appended");
+    }
+    while (commit_running)
+    {
+        durable_changed.wait(lock);
+    }
+    if (failed)
+    {
+        throw std::runtime_error("Write error: " + file_path);
+    }
+
+    uint64_t through = sequence < durable_sequence ? sequence : durable_sequence;
+    long long keep = static_cast<long long>(durable_sequence - through) * static_cast<long long>(frame_size);
+    long long limit = durable_offset;
+    if (keep >= limit)
+    {
+        return;
+    }
+
+    commit_running = true;
+    lock.unlock();
+
+    bool compacted = false;
+    try
+    {
+        compacted = compact(limit - keep, limit);
+    }
+    catch (...)
+    {
+    }
+
+    lock.lock();
+    commit_running = false;
+    if (compacted)
+    {
+        end_offset -= limit - keep;
+        durable_offset -= limit - keep;
+    }
+    durable_changed.notify_all();
+
+    if (!compacted)
+    {
+        throw std::runtime_error("Cannot truncate file: " + file_path);
+    }
+}
+
+template <typename T>
+template <typename t_func>
+int wal_stream<T>::replay(t_func func) const
+{
+    long long limit;
+    uint64_t last;
+    {
+        std::lock_guard<std::mutex> lock(log_mutex);
+        limit = durable_offset;
+        last = durable_sequence;
+    }
+
+    std::vector<char> batch(frame_size * recovery_batch);
+    uint64_t expected = last - static_cast<uint64_t>(limit / frame_size) + 1;
+    int replayed = 0;
+    for (long long offset = 0; offset < limit; offset += static_cast<long long>(batch.size()))
+    {
+        size_t size = limit - offset < static_cast<long long>(batch.size()) ? static_cast<size_t>(limit - offset) : batch.size();
+        if (read_bytes(offset, batch.data(), size) != static_cast<long long>(size))
+        {
+            throw std::runtime_error("Incomplete read");
+        }
+        for (size_t f = 0; f + frame_size <= size; f += frame_size)
+        {
+            T item;
+            if (!decode(batch.data() + f, expected++, item))
+            {
+                throw std::runtime_error("Corrupted log frame: " + file_path);
+            }
+            func(item);
+            replayed++;
+        }
+    }
+    return replayed;
+}
+
+template <typename T>
+int wal_stream<T>::get_count() const
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return static_cast<int>(durable_offset / frame_size);
+}
+
+template <typename T>
+uint64_t wal_stream<T>::get_last_sequence() const
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return next_sequence - 1;
+}
+
+template <typename T>
+int64_t wal_stream<T>::get_commit_count() const
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return commit_count;
+}
+
+template <typename T>
+int64_t wal_stream<T>::get_recovered_count() const
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return recovered_count;
+}
+
+template <typename T>
+long long wal_stream<T>::get_truncated_bytes() const
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return truncated_bytes;
+}
+
+template <typename T>
+void wal_stream<T>::recover()
+{
+#if !defined(_WIN32)
+    struct stat info;
+    if (fstat(descriptor, &info) != 0)
+    {
+        throw std::runtime_error("Cannot stat file: " + file_path);
+    }
+
+    std::vector<char> batch(frame_size * recovery_batch);
+    long long valid = 0;
+    uint64_t expected = 0;
+    bool torn = false;
+    while (!torn && valid < info.st_size)
+    {
+        long long read = read_bytes(valid, batch.data(), batch.size());
+        size_t f = 0;
+        for (; f + frame_size <= static_cast<size_t>(read); f += frame_size)
+        {
+            frame_header header;
+            std::memcpy(&header, batch.data() + f, sizeof(frame_header));
+            T item;
+            if (!decode(batch.data() + f, expected == 0 ? header.sequence : expected, item) || header.sequence == 0)
+            {
+                torn = true;
+                break;
+            }
+            expected = header.sequence + 1;
+            valid += frame_size;
+            recovered_count++;
+        }
+        if (read == 0 || f < static_cast<size_t>(read))
+        {
+            torn = true;
+        }
+    }
+
+    if (valid < info.st_size)
+    {
+        if (ftruncate(descriptor, static_cast<off_t>(valid)) != 0 || fsync(descriptor) != 0)
+        {
+            throw std::runtime_error("Cannot truncate file: " + file_path);
+        }
+        truncated_bytes = info.st_size - valid;
+    }
+
+    next_sequence = expected == 0 ? 1 : expected;
+    durable_sequence = next_sequence - 1;
+    end_offset = valid;
+    durable_offset = valid;
+#endif
+}
+
+template <typename T>
+void wal_stream<T>::commit_batch(std::unique_lock<std::mutex> &lock)
+{
+    commit_running = true;
+    if (commit_interval_us > 0)
+    {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::microseconds(commit_interval_us));
+        lock.lock();
+    }
+
+    committing.swap(pending);
+    pending.clear();
+    uint64_t last = next_sequence - 1;
+    long long offset = end_offset;
+    end_offset += static_cast<long long>(committing.size());
+    lock.unlock();
+
+    bool written = write_bytes(offset, committing.data(), committing.size());
+
+    lock.lock();
+    commit_running = false;
+    if (written)
+    {
+        durable_sequence = last;
+        durable_offset = end_offset;
+        commit_count++;
+    }
+    else
+    {
+        failed = true;
+    }
+    committing.clear();
+    durable_changed.notify_all();
+
+    if (!written)
+    {
+        throw std::runtime_error("Write error: " + file_path);
+    }
+}
+
+template <typename T>
+bool wal_stream<T>::compact(long long first, long long limit)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    if (first == limit)
+    {
+        return ftruncate(descriptor, 0) == 0 && fsync(descriptor) == 0;
+    }
+
+    std::vector<char> kept(static_cast<size_t>(limit - first));
+    if (read_bytes(first, kept.data(), kept.size()) != static_cast<long long>(kept.size()))
+    {
+        return false;
+    }
+
+    std::string temporary = file_path + ".tmp";
+    int replacement = open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (replacement == -1)
+    {
+        return false;
+    }
+    if (!write_all(replacement, 0, kept.data(), kept.size()) || fsync(replacement) != 0 ||
+        std::rename(temporary.c_str(), file_path.c_str()) != 0)
+    {
+        close(replacement);
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    size_t slash = file_path.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : file_path.substr(0, slash));
+    int parent = open(directory.c_str(), O_RDONLY);
+    if (parent != -1)
+    {
+        fsync(parent);
+        close(parent);
+    }
+
+    close(descriptor);
+    descriptor = replacement;
+    return true;
+#endif
+}
+
+template <typename T>
+bool wal_stream<T>::write_bytes(long long offset, const char *buffer, size_t size)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    if (!write_all(descriptor, offset, buffer, size))
+    {
+        return false;
+    }
+#if defined(__APPLE__)
+    return fsync(descriptor) == 0;
+#else
+    return fdatasync(descriptor) == 0;
+#endif
+#endif
+}
+
+template <typename T>
+bool wal_stream<T>::write_all(int target, long long offset, const char *buffer, size_t size)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    size_t done = 0;
+    while (done < size)
+    {
+        ssize_t result = pwrite(target, buffer + done, size - done, static_cast<off_t>(offset + done));
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        done += result;
+    }
+    return true;
+#endif
+}
+
+template <typename T>
+long long wal_stream<T>::read_bytes(long long offset, char *buffer, size_t size) const
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    size_t done = 0;
+    while (done < size)
+    {
+        ssize_t result = pread(descriptor, buffer + done, size - done, static_cast<off_t>(offset + done));
+        if (result == 0)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("Read error: " + file_path);
+        }
+        done += result;
+    }
+    return static_cast<long long>(done);
+#endif
+}
+
+template <typename T>
+bool wal_stream<T>::decode(const char *frame, uint64_t expected_sequence, T &item)
+{
+    frame_header header;
+    std::memcpy(&header, frame, sizeof(frame_header));
+    if (header.magic != frame_magic || header.sequence != expected_sequence ||
+        header.checksum != checksum(header.sequence, frame + sizeof(frame_header), sizeof(T)))
+    {
+        return false;
+    }
+    std::memcpy(&item, frame + sizeof(frame_header), sizeof(T));
+    return true;
+}
+
+template <typename T>
+uint32_t wal_stream<T>::checksum(uint64_t sequence, const char *data, size_t size)
+{
+    static const std::array<uint32_t, 256> table = []()
+    {
+        std::array<uint32_t, 256> result{};
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                value = (value >> 1) ^ (0xedb88320u & (0u - (value & 1u)));
+            }
+            result[i] = value;
+        }
+        return result;
+    }();
+
+    uint32_t crc = 0xffffffffu;
+    auto update = [&crc](unsigned char byte)
+    {
+        crc = (crc >> 8) ^ table[(crc ^ byte) & 0xffu];
+    };
+
+    for (int i = 0; i < 8; i++)
+    {
+        update(static_cast<unsigned char>(sequence >> (8 * i)));
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        update(static_cast<unsigned char>(data[i]));
+    }
+    return ~crc;
+}
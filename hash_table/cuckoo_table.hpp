@@ -0,0 +1,81 @@
+#pragma once
+
+#include "i_dictionary.hpp"
+#include "hash_mix.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+
+template <typename t_key, typename t_value> class cuckoo_table_iterator;
+
+template <typename t_key, typename t_value>
+class cuckoo_table : public i_dictionary<t_key, t_value>
+{
+public:
+    static constexpr int slots = 8;
+
+    struct alignas(64) bucket
+    {
+        t_key keys[slots];
+        t_value values[slots];
+    };
+
+private:
+    static constexpr int max_search_nodes = 512;
+    static constexpr double max_load_factor = 0.95;
+
+    struct search_node
+    {
+        int bucket_index;
+        int parent;
+        int slot;
+    };
+
+    array_sequence<bucket> buckets;
+    array_sequence<uint8_t> occupied;
+    int count;
+    int bucket_mask;
+
+    std::function<size_t(const t_key &)> hash_function;
+
+public:
+    cuckoo_table(const std::function<size_t(const t_key &)> &hash_function = std::hash<t_key>(), int capacity = 64);
+    ~cuckoo_table() = default;
+
+    int get_count() const override;
+    int get_capacity() const override;
+
+    size_t erase(const t_key &key);
+
+    const t_value &get(const t_key &key) const override;
+
+    cuckoo_table<t_key, t_value> &set(const t_key &key, const t_value &value);
+    cuckoo_table<t_key, t_value> &del(const t_key &key);
+    cuckoo_table<t_key, t_value> &rehash(int new_capacity);
+
+    void add(const t_key &key, const t_value &value) override;
+    void remove(const t_key &key) override;
+
+    bool contains_key(const t_key &key) const override;
+
+    double get_load_factor() const;
+
+    i_iterator<t_key> *get_keys_iterator() const override;
+
+private:
+    int primary_bucket(uint64_t hash) const;
+    int alternate_bucket(uint64_t hash) const;
+    uint64_t key_hash(const t_key &key) const;
+
+    bool find(const t_key &key, int &bucket_index, int &slot) const;
+    bool try_place(const t_key &key, const t_value &value, uint64_t hash);
+    bool displace(int first, int second, int &bucket_index, int &slot);
+
+    static unsigned match_slots(const t_key *keys, const t_key &key);
+    static int first_free(uint8_t mask);
+    static int bucket_count_for(int capacity);
+
+    friend class cuckoo_table_iterator<t_key, t_value>;
+};
+
+#include "cuckoo_table.tpp"
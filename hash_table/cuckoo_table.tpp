@@ -0,0 +1,353 @@
+#include "cuckoo_table.hpp"
+#include "cuckoo_table_iterator.hpp"
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+template <typename t_key, typename t_value>
+cuckoo_table<t_key, t_value>::cuckoo_table(const std::function<size_t(const t_key &)> &hash_func, int capacity)
+    : count(0), bucket_mask(0), hash_function(hash_func)
+{
+    if (capacity < 0)
+    {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+
+    int bucket_count = bucket_count_for(capacity);
+    buckets = array_sequence<bucket>(bucket_count);
+    occupied = array_sequence<uint8_t>(bucket_count);
+    for (int i = 0; i < bucket_count; i++)
+    {
+        buckets[i] = bucket{};
+        occupied[i] = 0;
+    }
+    bucket_mask = bucket_count - 1;
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::get_count() const
+{
+    return count;
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::get_capacity() const
+{
+    return buckets.get_length() * slots;
+}
+
+template <typename t_key, typename t_value>
+size_t cuckoo_table<t_key, t_value>::erase(const t_key &key)
+{
+    int bucket_index;
+    int slot;
+    if (!find(key, bucket_index, slot))
+    {
+        return 0;
+    }
+
+    occupied[bucket_index] &= static_cast<uint8_t>(~(1u << slot));
+    count--;
+    return 1;
+}
+
+template <typename t_key, typename t_value>
+const t_value &cuckoo_table<t_key, t_value>::get(const t_key &key) const
+{
+    int bucket_index;
+    int slot;
+    if (!find(key, bucket_index, slot))
+    {
+        throw std::out_of_range("Key not found");
+    }
+    return buckets[bucket_index].values[slot];
+}
+
+template <typename t_key, typename t_value>
+cuckoo_table<t_key, t_value> &cuckoo_table<t_key, t_value>::set(const t_key &key, const t_value &value)
+{
+    int bucket_index;
+    int slot;
+    if (find(key, bucket_index, slot))
+    {
+        buckets[bucket_index].values[slot] = value;
+        return *this;
+    }
+
+    if (count + 1 > max_load_factor * get_capacity())
+    {
+        rehash(get_capacity() * 2);
+    }
+
+    uint64_t hash = key_hash(key);
+    while (!try_place(key, value, hash))
+    {
+        rehash(get_capacity() * 2);
+    }
+    count++;
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+cuckoo_table<t_key, t_value> &cuckoo_table<t_key, t_value>::del(const t_key &key)
+{
+    erase(key);
+
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+cuckoo_table<t_key, t_value> &cuckoo_table<t_key, t_value>::rehash(int new_capacity)
+{
+    if (new_capacity < count)
+    {
+        throw std::invalid_argument("Capacity must be bigger than count");
+    }
+
+    array_sequence<bucket> old_buckets = buckets;
+    array_sequence<uint8_t> old_occupied = occupied;
+
+    for (int bucket_count = bucket_count_for(new_capacity);; bucket_count *= 2)
+    {
+        buckets = array_sequence<bucket>(bucket_count);
+        occupied = array_sequence<uint8_t>(bucket_count);
+        for (int i = 0; i < bucket_count; i++)
+        {
+            buckets[i] = bucket{};
+            occupied[i] = 0;
+        }
+        bucket_mask = bucket_count - 1;
+
+        bool placed_all = true;
+        for (int b = 0; b < old_buckets.get_length() && placed_all; b++)
+        {
+            for (int s = 0; s < slots && placed_all; s++)
+            {
+                if (old_occupied[b] & (1u << s))
+                {
+                    const t_key &key = old_buckets[b].keys[s];
+                    placed_all = try_place(key, old_buckets[b].values[s], key_hash(key));
+                }
+            }
+        }
+
+        if (placed_all)
+        {
+            return *this;
+        }
+    }
+}
+
+template <typename t_key, typename t_value>
+void cuckoo_table<t_key, t_value>::add(const t_key &key, const t_value &value)
+{
+    this->set(key, value);
+}
+
+template <typename t_key, typename t_value>
+void cuckoo_table<t_key, t_value>::remove(const t_key &key)
+{
+    if (erase(key) == 0)
+    {
+        throw std::out_of_range("Key not found");
+    }
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table<t_key, t_value>::contains_key(const t_key &key) const
+{
+    int bucket_index;
+    int slot;
+    return find(key, bucket_index, slot);
+}
+
+template <typename t_key, typename t_value>
+double cuckoo_table<t_key, t_value>::get_load_factor() const
+{
+    return static_cast<double>(count) / get_capacity();
+}
+
+template <typename t_key, typename t_value>
+i_iterator<t_key> *cuckoo_table<t_key, t_value>::get_keys_iterator() const
+{
+    return new cuckoo_table_iterator<t_key, t_value>(*this);
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::primary_bucket(uint64_t hash) const
+{
+    return static_cast<int>(hash & bucket_mask);
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::alternate_bucket(uint64_t hash) const
+{
+    int first = primary_bucket(hash);
+    int second = static_cast<int>((hash >> 32) & bucket_mask);
+    return second == first ? first ^ 1 : second;
+}
+
+template <typename t_key, typename t_value>
+uint64_t cuckoo_table<t_key, t_value>::key_hash(const t_key &key) const
+{
+    return mix64(static_cast<uint64_t>(hash_function(key)));
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table<t_key, t_value>::find(const t_key &key, int &bucket_index, int &slot) const
+{
+    uint64_t hash = key_hash(key);
+
+    int first = primary_bucket(hash);
+    unsigned mask = match_slots(buckets[first].keys, key) & occupied[first];
+    if (mask != 0)
+    {
+        bucket_index = first;
+        slot = std::countr_zero(mask);
+        return true;
+    }
+
+    int second = alternate_bucket(hash);
+    mask = match_slots(buckets[second].keys, key) & occupied[second];
+    if (mask != 0)
+    {
+        bucket_index = second;
+        slot = std::countr_zero(mask);
+        return true;
+    }
+
+    return false;
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table<t_key, t_value>::try_place(const t_key &key, const t_value &value, uint64_t hash)
+{
+    int first = primary_bucket(hash);
+    int second = alternate_bucket(hash);
+
+    int bucket_index = first;
+    int slot = first_free(occupied[first]);
+    if (slot < 0)
+    {
+        bucket_index = second;
+        slot = first_free(occupied[second]);
+    }
+    if (slot < 0 && !displace(first, second, bucket_index, slot))
+    {
+        return false;
+    }
+
+    buckets[bucket_index].keys[slot] = key;
+    buckets[bucket_index].values[slot] = value;
+    occupied[bucket_index] |= static_cast<uint8_t>(1u << slot);
+    return true;
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table<t_key, t_value>::displace(int first, int second, int &bucket_index, int &slot)
+{
+    search_node nodes[max_search_nodes];
+    int head = 0;
+    int tail = 0;
+    nodes[tail++] = search_node{first, -1, -1};
+    nodes[tail++] = search_node{second, -1, -1};
+
+    while (head < tail)
+    {
+        int current = head++;
+        for (int s = 0; s < slots && tail < max_search_nodes; s++)
+        {
+            uint64_t hash = key_hash(buckets[nodes[current].bucket_index].keys[s]);
+            int next = primary_bucket(hash) == nodes[current].bucket_index ? alternate_bucket(hash) : primary_bucket(hash);
+
+            bool on_path = false;
+            for (int n = current; n >= 0 && !on_path; n = nodes[n].parent)
+            {
+                on_path = nodes[n].bucket_index == next;
+            }
+            if (on_path)
+            {
+                continue;
+            }
+
+            nodes[tail++] = search_node{next, current, s};
+            int free_slot = first_free(occupied[next]);
+            if (free_slot < 0)
+            {
+                continue;
+            }
+
+            int child = tail - 1;
+            while (nodes[child].parent >= 0)
+            {
+                bucket &from = buckets[nodes[nodes[child].parent].bucket_index];
+                bucket &to = buckets[nodes[child].bucket_index];
+                to.keys[free_slot] = from.keys[nodes[child].slot];
+                to.values[free_slot] = from.values[nodes[child].slot];
+                occupied[nodes[child].bucket_index] |= static_cast<uint8_t>(1u << free_slot);
+
+                free_slot = nodes[child].slot;
+                occupied[nodes[nodes[child].parent].bucket_index] &= static_cast<uint8_t>(~(1u << free_slot));
+                child = nodes[child].parent;
+            }
+
+            bucket_index = nodes[child].bucket_index;
+            slot = free_slot;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename t_key, typename t_value>
+unsigned cuckoo_table<t_key, t_value>::match_slots(const t_key *keys, const t_key &key)
+{
+    if constexpr (std::is_integral_v<t_key> && sizeof(t_key) == 4 && slots == 8)
+    {
+#if defined(__AVX2__)
+        __m256i needle = _mm256_set1_epi32(static_cast<int>(key));
+        __m256i stored = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys));
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(stored, needle))));
+#elif defined(__SSE2__) || defined(_M_X64)
+        __m128i needle = _mm_set1_epi32(static_cast<int>(key));
+        __m128i low = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys)), needle);
+        __m128i high = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + 4)), needle);
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(low)) | (_mm_movemask_ps(_mm_castsi128_ps(high)) << 4));
+#endif
+    }
+
+    unsigned mask = 0;
+    for (int i = 0; i < slots; i++)
+    {
+        if (keys[i] == key)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::first_free(uint8_t mask)
+{
+    unsigned free_mask = static_cast<uint8_t>(~mask);
+    return free_mask == 0 ? -1 : std::countr_zero(free_mask);
+}
+
+template <typename t_key, typename t_value>
+int cuckoo_table<t_key, t_value>::bucket_count_for(int capacity)
+{
+    int bucket_count = 2;
+    while (bucket_count * slots < capacity)
+    {
+        bucket_count *= 2;
+    }
+    return bucket_count;
+}
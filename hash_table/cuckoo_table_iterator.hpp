@@ -0,0 +1,28 @@
+#pragma once
+
+#include "i_iterator.hpp"
+
+template <typename t_key, typename t_value> class cuckoo_table;
+
+template <typename t_key, typename t_value>
+class cuckoo_table_iterator : public i_iterator<t_key>
+{
+private:
+    const cuckoo_table<t_key, t_value> *table;
+    int current_bucket;
+    int current_slot;
+
+public:
+    explicit cuckoo_table_iterator(const cuckoo_table<t_key, t_value> &table_ref);
+
+    bool has_next() const override;
+    bool next() override;
+    bool try_get_current(t_key &element) override;
+
+    t_key get_current() const override;
+
+private:
+    bool find_next_occupied(int &bucket_index, int &slot) const;
+};
+
+#include "cuckoo_table_iterator.tpp"
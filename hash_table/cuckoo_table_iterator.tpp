@@ -0,0 +1,77 @@
+#include "cuckoo_table_iterator.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+cuckoo_table_iterator<t_key, t_value>::cuckoo_table_iterator(const cuckoo_table<t_key, t_value> &table_ref)
+    : table(&table_ref), current_bucket(0), current_slot(-1)
+{
+    if (!find_next_occupied(current_bucket, current_slot))
+    {
+        current_bucket = table->buckets.get_length();
+    }
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table_iterator<t_key, t_value>::has_next() const
+{
+    int bucket_index = current_bucket;
+    int slot = current_slot;
+    return find_next_occupied(bucket_index, slot);
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table_iterator<t_key, t_value>::next()
+{
+    int bucket_index = current_bucket;
+    int slot = current_slot;
+    if (!find_next_occupied(bucket_index, slot))
+    {
+        return false;
+    }
+    current_bucket = bucket_index;
+    current_slot = slot;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table_iterator<t_key, t_value>::try_get_current(t_key &element)
+{
+    if (current_bucket >= table->buckets.get_length())
+    {
+        return false;
+    }
+    element = table->buckets[current_bucket].keys[current_slot];
+    return true;
+}
+
+template <typename t_key, typename t_value>
+t_key cuckoo_table_iterator<t_key, t_value>::get_current() const
+{
+    if (current_bucket >= table->buckets.get_length())
+    {
+        throw std::out_of_range("Iterator is out of range");
+    }
+    return table->buckets[current_bucket].keys[current_slot];
+}
+
+template <typename t_key, typename t_value>
+bool cuckoo_table_iterator<t_key, t_value>::find_next_occupied(int &bucket_index, int &slot) const
+{
+    int b = bucket_index;
+    int s = slot + 1;
+    while (b < table->buckets.get_length())
+    {
+        for (; s < cuckoo_table<t_key, t_value>::slots; s++)
+        {
+            if (table->occupied[b] & (1u << s))
+            {
+                bucket_index = b;
+                slot = s;
+                return true;
+            }
+        }
+        b++;
+        s = 0;
+    }
+    return false;
+}
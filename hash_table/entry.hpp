@@ -1,11 +1,18 @@
 #pragma once
 
+#include <utility>
+
 template <typename t_key, typename t_value>
 struct entry
 {
-    t_key key;
-    t_value value;
+    t_key key{};
+    t_value value{};
 
     entry() = default;
-    entry(const t_key &key, const t_value &value) : key(key), value(value) {}
+    constexpr entry(const t_key &key, const t_value &value) : key(key), value(value) {}
+    constexpr entry(t_key &&key, t_value &&value) : key(std::move(key)), value(std::move(value)) {}
+
+    template <typename t_key_arg, typename... t_args>
+    constexpr entry(std::in_place_t, t_key_arg &&key, t_args &&...args)
+        : key(std::forward<t_key_arg>(key)), value(std::forward<t_args>(args)...) {}
 };
\ No newline at end of file
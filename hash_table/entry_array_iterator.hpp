@@ -0,0 +1,24 @@
+#pragma once
+
+#include "i_iterator.hpp"
+#include "entry.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+
+template <typename t_key, typename t_value>
+class entry_array_iterator : public i_iterator<t_key>
+{
+private:
+    const array_sequence<entry<t_key, t_value>> *entries;
+    int index;
+
+public:
+    explicit entry_array_iterator(const array_sequence<entry<t_key, t_value>> &entries_ref);
+
+    bool has_next() const override;
+    bool next() override;
+    bool try_get_current(t_key &element) override;
+
+    t_key get_current() const override;
+};
+
+#include "entry_array_iterator.tpp"
\ No newline at end of file
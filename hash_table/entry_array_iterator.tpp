@@ -0,0 +1,46 @@
+#include "entry_array_iterator.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+entry_array_iterator<t_key, t_value>::entry_array_iterator(const array_sequence<entry<t_key, t_value>> &entries_ref)
+    : entries(&entries_ref), index(0)
+{
+}
+
+template <typename t_key, typename t_value>
+bool entry_array_iterator<t_key, t_value>::has_next() const
+{
+    return index + 1 < entries->get_length();
+}
+
+template <typename t_key, typename t_value>
+bool entry_array_iterator<t_key, t_value>::next()
+{
+    if (!has_next())
+    {
+        return false;
+    }
+    ++index;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+bool entry_array_iterator<t_key, t_value>::try_get_current(t_key &element)
+{
+    if (index >= entries->get_length())
+    {
+        return false;
+    }
+    element = entries->get(index).key;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+t_key entry_array_iterator<t_key, t_value>::get_current() const
+{
+    if (index >= entries->get_length())
+    {
+        throw std::out_of_range("Iterator is out of range");
+    }
+    return entries->get(index).key;
+}
\ No newline at end of file
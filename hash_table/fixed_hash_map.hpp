@@ -0,0 +1,71 @@
+#pragma once
+
+#include "i_readonly_dictionary.hpp"
+#include "entry.hpp"
+#include "hash_mix.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+
+template <typename t_key>
+struct fixed_hash
+{
+    constexpr size_t operator()(const t_key &key) const
+    {
+        if constexpr (std::is_integral_v<t_key> || std::is_enum_v<t_key>)
+        {
+            return static_cast<size_t>(mix64(static_cast<uint64_t>(key)));
+        }
+        else
+        {
+            std::string_view view(key);
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (char c : view)
+            {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+            }
+            return static_cast<size_t>(mix64(hash));
+        }
+    }
+};
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash = fixed_hash<t_key>>
+class fixed_hash_map : public i_readonly_dictionary<t_key, t_value>
+{
+    static_assert(t_capacity > 0, "Fixed hash map capacity must be positive");
+
+public:
+    static constexpr size_t slot_count = std::bit_ceil(t_capacity * 2);
+
+private:
+    std::array<entry<t_key, t_value>, slot_count> entries{};
+    std::array<bool, slot_count> occupied{};
+    int count = 0;
+    t_hash hash_function{};
+
+public:
+    constexpr fixed_hash_map() = default;
+    constexpr fixed_hash_map(std::initializer_list<entry<t_key, t_value>> items);
+    constexpr ~fixed_hash_map() override = default;
+
+    constexpr int get_count() const override;
+    constexpr int get_capacity() const override;
+
+    constexpr const t_value &get(const t_key &key) const override;
+    constexpr const t_value *find(const t_key &key) const;
+
+    constexpr fixed_hash_map &set(const t_key &key, const t_value &value);
+
+    constexpr bool contains_key(const t_key &key) const override;
+
+    i_iterator<t_key> *get_keys_iterator() const override;
+
+private:
+    constexpr size_t probe(const t_key &key) const;
+};
+
+#include "fixed_hash_map.tpp"
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "fixed_hash_map.hpp"
+#include "fixed_hash_map_iterator.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr fixed_hash_map<t_key, t_value, t_capacity, t_hash>::fixed_hash_map(std::initializer_list<entry<t_key, t_value>> items)
+{
+    for (const auto &item : items)
+    {
+        if (contains_key(item.key))
+        {
+            throw std::invalid_argument("Duplicate key");
+        }
+        set(item.key, item.value);
+    }
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr int fixed_hash_map<t_key, t_value, t_capacity, t_hash>::get_count() const
+{
+    return count;
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr int fixed_hash_map<t_key, t_value, t_capacity, t_hash>::get_capacity() const
+{
+    return static_cast<int>(t_capacity);
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr const t_value &fixed_hash_map<t_key, t_value, t_capacity, t_hash>::get(const t_key &key) const
+{
+    const t_value *value = find(key);
+    if (value == nullptr)
+    {
+        throw std::out_of_range("Key not found");
+    }
+    return *value;
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr const t_value *fixed_hash_map<t_key, t_value, t_capacity, t_hash>::find(const t_key &key) const
+{
+    size_t slot = probe(key);
+    return occupied[slot] ? &entries[slot].value : nullptr;
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr fixed_hash_map<t_key, t_value, t_capacity, t_hash> &fixed_hash_map<t_key, t_value, t_capacity, t_hash>::set(const t_key &key, const t_value &value)
+{
+    size_t slot = probe(key);
+    if (!occupied[slot])
+    {
+        if (count == static_cast<int>(t_capacity))
+        {
+            throw std::invalid_argument("Fixed hash map is full");
+        }
+        entries[slot].key = key;
+        occupied[slot] = true;
+        count++;
+    }
+    entries[slot].value = value;
+    return *this;
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr bool fixed_hash_map<t_key, t_value, t_capacity, t_hash>::contains_key(const t_key &key) const
+{
+    return occupied[probe(key)];
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+i_iterator<t_key> *fixed_hash_map<t_key, t_value, t_capacity, t_hash>::get_keys_iterator() const
+{
+    return new fixed_hash_map_iterator<t_key, t_value>(entries.data(), occupied.data(), static_cast<int>(slot_count));
+}
+
+template <typename t_key, typename t_value, size_t t_capacity, typename t_hash>
+constexpr size_t fixed_hash_map<t_key, t_value, t_capacity, t_hash>::probe(const t_key &key) const
+{
+    size_t slot = hash_function(key) & (slot_count - 1);
+    while (occupied[slot] && !(entries[slot].key == key))
+    {
+        slot = (slot + 1) & (slot_count - 1);
+    }
+    return slot;
+}
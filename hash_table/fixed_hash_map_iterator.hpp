@@ -0,0 +1,28 @@
+#pragma once
+
+#include "i_iterator.hpp"
+#include "entry.hpp"
+
+template <typename t_key, typename t_value>
+class fixed_hash_map_iterator : public i_iterator<t_key>
+{
+private:
+    const entry<t_key, t_value> *entries;
+    const bool *occupied;
+    int slot_count;
+    int current;
+
+public:
+    fixed_hash_map_iterator(const entry<t_key, t_value> *entries, const bool *occupied, int slot_count);
+
+    bool has_next() const override;
+    bool next() override;
+    bool try_get_current(t_key &element) override;
+
+    t_key get_current() const override;
+
+private:
+    int find_next_occupied(int slot) const;
+};
+
+#include "fixed_hash_map_iterator.tpp"
\ No newline at end of file
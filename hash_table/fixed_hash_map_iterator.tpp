@@ -0,0 +1,57 @@
+#include "fixed_hash_map_iterator.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+fixed_hash_map_iterator<t_key, t_value>::fixed_hash_map_iterator(const entry<t_key, t_value> *entries, const bool *occupied, int slot_count)
+    : entries(entries), occupied(occupied), slot_count(slot_count), current(0)
+{
+    current = find_next_occupied(0);
+}
+
+template <typename t_key, typename t_value>
+bool fixed_hash_map_iterator<t_key, t_value>::has_next() const
+{
+    return current < slot_count && find_next_occupied(current + 1) < slot_count;
+}
+
+template <typename t_key, typename t_value>
+bool fixed_hash_map_iterator<t_key, t_value>::next()
+{
+    if (!has_next())
+    {
+        return false;
+    }
+    current = find_next_occupied(current + 1);
+    return true;
+}
+
+template <typename t_key, typename t_value>
+bool fixed_hash_map_iterator<t_key, t_value>::try_get_current(t_key &element)
+{
+    if (current >= slot_count)
+    {
+        return false;
+    }
+    element = entries[current].key;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+t_key fixed_hash_map_iterator<t_key, t_value>::get_current() const
+{
+    if (current >= slot_count)
+    {
+        throw std::out_of_range("Iterator is out of range");
+    }
+    return entries[current].key;
+}
+
+template <typename t_key, typename t_value>
+int fixed_hash_map_iterator<t_key, t_value>::find_next_occupied(int slot) const
+{
+    while (slot < slot_count && !occupied[slot])
+    {
+        slot++;
+    }
+    return slot;
+}
@@ -3,9 +3,12 @@
 #include "../pointers/shared_ptr.hpp"
 #include "i_dictionary.hpp"
 #include "entry.hpp"
+#include "hash_mix.hpp"
+#include "heap_size.hpp"
 #include "../lab3_2ndsem/headers/array_sequence.hpp"
 #include "../lab3_2ndsem/headers/list_sequence.hpp"
 #include "i_iterator.hpp"
+#include <cstdint>
 #include <functional>
 #include <iostream>
 
@@ -15,12 +18,35 @@ template <typename t_key, typename t_value>
 class hash_table : public i_dictionary<t_key, t_value> 
 {
 private:
+    enum class hash_mode
+    {
+        direct,
+        seeded,
+        fallback
+    };
+
+    static constexpr int default_chain_limit = 32;
+    static constexpr int min_shrink_capacity = 8;
+    static constexpr int shrink_step = 4;
+    static constexpr size_t chain_node_overhead = 2 * sizeof(void *);
+    static constexpr bool has_fallback_hash = requires(const t_key &key) { std::hash<t_key>{}(key); };
+
     array_sequence<list_sequence<entry<t_key, t_value>>> buckets;
     int count;
     int capacity;
 
     std::function<int (const t_key &)> hash_function;
 
+    hash_mode mode;
+    uint64_t seed;
+    int chain_limit;
+    int reseed_count;
+    int reseed_floor;
+
+    double shrink_load_factor;
+    double shrink_target_load;
+    int fold_capacity;
+
 public:
     hash_table(const std::function<int (const t_key &)> &hash_function, int capacity = 8);
     ~hash_table() = default;
@@ -35,11 +61,23 @@ public:
     const t_value &get(const t_key &key) const override;
 
     hash_table<t_key, t_value> &set(const t_key &key, const t_value &value);
+
+    template <typename t_key_arg, typename t_value_arg>
+    bool insert_or_assign(t_key_arg &&key, t_value_arg &&value);
+
+    template <typename t_key_arg, typename... t_args>
+    bool try_emplace(t_key_arg &&key, t_args &&...args);
+
+    template <typename... t_args>
+    bool emplace(t_args &&...args);
+
     hash_table<t_key, t_value> &del(const t_key &key);
     hash_table<t_key, t_value> &set_capacity(int new_capacity);
     hash_table<t_key, t_value> &rehash(int new_capacity);
     hash_table<t_key, t_value> &resize();
     hash_table<t_key, t_value> &resize_if_needed();
+    hash_table<t_key, t_value> &reserve(int expected_count);
+    hash_table<t_key, t_value> &shrink_to_fit();
 
     void add(const t_key &key, const t_value &value) override;
     void remove(const t_key &key) override;
@@ -48,6 +86,13 @@ public:
     bool is_consistent() const;
 
     double get_load_factor() const;
+    int get_max_chain_length() const;
+    int get_reseed_count() const;
+
+    void set_chain_limit(int limit);
+    void set_shrink_policy(double low_load_factor, double target_load_factor = 0.5);
+
+    size_t memory_usage() const;
 
     array_sequence<int> get_bucket_distribution() const;
 
@@ -67,6 +112,16 @@ public:
 private:
     shared_ptr<entry<t_key, t_value>> find_in_bucket(int index, const t_key &key);
 
+    int bucket_index(const t_key &key) const;
+    uint64_t fallback_hash(const t_key &key) const;
+
+    size_t erase_entry(const t_key &key);
+    void shrink_if_needed();
+
+    void guard_chain(int index);
+    void strengthen_hash();
+    void redistribute(int new_capacity);
+
 };
 
 #include "hash.tpp"
\ No newline at end of file
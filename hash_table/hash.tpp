@@ -4,7 +4,9 @@
 
 template <typename t_key, typename t_value>
 hash_table<t_key, t_value>::hash_table(const std::function<int(const t_key&)> &hash_func, int capacity)
-    : hash_function(hash_func), count(0), capacity(capacity)
+    : hash_function(hash_func), count(0), capacity(capacity),
+      mode(hash_mode::direct), seed(0), chain_limit(default_chain_limit), reseed_count(0), reseed_floor(0),
+      shrink_load_factor(0.0), shrink_target_load(0.5), fold_capacity(0)
 {
     if (capacity < 0)
     {
@@ -41,7 +43,7 @@ int hash_table<t_key, t_value>::calc_value(const t_key &key) const
 template <typename t_key, typename t_value>
 const t_value &hash_table<t_key, t_value>::get(const t_key &key) const
 {
-    int index = hash_function(key) % capacity;
+    int index = bucket_index(key);
     const auto &bucket = buckets[index];
     for (int i = 0; i < bucket.get_length(); i++)
     {
@@ -56,29 +58,73 @@ const t_value &hash_table<t_key, t_value>::get(const t_key &key) const
 template <typename t_key, typename t_value> 
 hash_table<t_key, t_value> &hash_table<t_key, t_value>::set(const t_key &key, const t_value &value)
 {
-    int index = hash_function(key) % capacity;
+    insert_or_assign(key, value);
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+template <typename t_key_arg, typename t_value_arg>
+bool hash_table<t_key, t_value>::insert_or_assign(t_key_arg &&key, t_value_arg &&value)
+{
+    int index = bucket_index(key);
     auto &bucket = buckets[index];
-    if (bucket.get_length() != 0)
+    for (auto &entry : bucket)
     {
-        for (auto &entry : bucket)
+        if (entry.key == key)
         {
-            if (entry.key == key)
-            {
-                entry.value = value;
-                return *this;
-            }
+            entry.value = std::forward<t_value_arg>(value);
+            return false;
         }
     }
-    bucket.append_element(entry<t_key, t_value>(key, value));
+    bucket.append_element(entry<t_key, t_value>(std::in_place, std::forward<t_key_arg>(key), std::forward<t_value_arg>(value)));
     count++;
+    guard_chain(index);
     resize_if_needed();
-    return *this;
+    shrink_if_needed();
+    return true;
+}
+
+template <typename t_key, typename t_value>
+template <typename t_key_arg, typename... t_args>
+bool hash_table<t_key, t_value>::try_emplace(t_key_arg &&key, t_args &&...args)
+{
+    int index = bucket_index(key);
+    auto &bucket = buckets[index];
+    for (auto &entry : bucket)
+    {
+        if (entry.key == key)
+        {
+            return false;
+        }
+    }
+    bucket.append_element(entry<t_key, t_value>(std::in_place, std::forward<t_key_arg>(key), std::forward<t_args>(args)...));
+    count++;
+    guard_chain(index);
+    resize_if_needed();
+    shrink_if_needed();
+    return true;
+}
+
+template <typename t_key, typename t_value>
+template <typename... t_args>
+bool hash_table<t_key, t_value>::emplace(t_args &&...args)
+{
+    entry<t_key, t_value> item(std::in_place, std::forward<t_args>(args)...);
+    return try_emplace(std::move(item.key), std::move(item.value));
 }
 
 template <typename t_key, typename t_value>
 size_t hash_table<t_key, t_value>::erase(const t_key &key)
 {
-    int index = hash_function(key) % capacity;
+    size_t removed = erase_entry(key);
+    shrink_if_needed();
+    return removed;
+}
+
+template <typename t_key, typename t_value>
+size_t hash_table<t_key, t_value>::erase_entry(const t_key &key)
+{
+    int index = bucket_index(key);
     auto &bucket = buckets[index];
     for (int i = 0; i < bucket.get_length(); i++)
     {
@@ -121,50 +167,48 @@ hash_table<t_key, t_value> &hash_table<t_key, t_value>::rehash(int new_capacity)
         throw std::invalid_argument("Capacity must be bigger than count");
     }
 
-    if (new_capacity == capacity)
+    if (new_capacity == capacity && fold_capacity == 0)
     {
         return *this;
     }
 
-    array_sequence<list_sequence<entry<t_key, t_value>>> old_buckets = buckets;
-    buckets.clear();
-    buckets = array_sequence<list_sequence<entry<t_key, t_value>>>(new_capacity);
-    capacity = new_capacity;
-
-    for (int i = 0; i < (old_buckets.get_length() < new_capacity ? old_buckets.get_length() : new_capacity); i++)
-    {
-        buckets[i] = old_buckets[i];
-    }
-
+    redistribute(new_capacity);
     return *this;
 }
 
 template <typename t_key, typename t_value>
 hash_table<t_key, t_value> &hash_table<t_key, t_value>::resize()
 {
-    capacity *= 2;    
-    array_sequence<list_sequence<entry<t_key, t_value>>> old_buckets = buckets;
-    buckets.clear();
-    buckets = array_sequence<list_sequence<entry<t_key, t_value>>>(capacity);
+    return rehash(capacity * 2);
+}
 
-    for (int i = 0; i < old_buckets.get_length(); i++)
+template <typename t_key, typename t_value>
+hash_table<t_key, t_value> &hash_table<t_key, t_value>::resize_if_needed()
+{
+    if (count == capacity - 1)
     {
-        buckets[i] = old_buckets[i];
+        rehash(capacity * 2);
     }
-
     return *this;
 }
 
 template <typename t_key, typename t_value>
-hash_table<t_key, t_value> &hash_table<t_key, t_value>::resize_if_needed()
+hash_table<t_key, t_value> &hash_table<t_key, t_value>::reserve(int expected_count)
 {
-    if (count == capacity - 1)
+    if (expected_count + 1 >= capacity)
     {
-        rehash(capacity * 2);
+        rehash(expected_count + 2);
     }
     return *this;
 }
 
+template <typename t_key, typename t_value>
+hash_table<t_key, t_value> &hash_table<t_key, t_value>::shrink_to_fit()
+{
+    int fitted = count + 2;
+    return rehash(fitted + fitted % 2);
+}
+
 template <typename t_key, typename t_value>
 void hash_table<t_key, t_value>::add(const t_key &key, const t_value &value)
 {
@@ -187,7 +231,7 @@ void hash_table<t_key, t_value>::remove(const t_key &key)
 template <typename t_key, typename t_value>
 bool hash_table<t_key, t_value>::contains_key(const t_key &key) const
 {
-    int index = hash_function(key) % capacity;
+    int index = bucket_index(key);
     const auto &bucket = buckets[index];
     for (int i = 0; i < bucket.get_length(); i++)
     {
@@ -216,6 +260,62 @@ double hash_table<t_key, t_value>::get_load_factor() const
     return static_cast<double>(count) / capacity;
 }
 
+template <typename t_key, typename t_value>
+int hash_table<t_key, t_value>::get_max_chain_length() const
+{
+    int longest = 0;
+    for (int i = 0; i < buckets.get_length(); i++)
+    {
+        longest = buckets[i].get_length() > longest ? buckets[i].get_length() : longest;
+    }
+    return longest;
+}
+
+template <typename t_key, typename t_value>
+int hash_table<t_key, t_value>::get_reseed_count() const
+{
+    return reseed_count;
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::set_chain_limit(int limit)
+{
+    if (limit < 0)
+    {
+        throw std::invalid_argument("Chain limit must be non-negative");
+    }
+    chain_limit = limit;
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::set_shrink_policy(double low_load_factor, double target_load_factor)
+{
+    if (low_load_factor < 0.0 || low_load_factor >= target_load_factor || target_load_factor >= 1.0)
+    {
+        throw std::invalid_argument("Shrink thresholds must satisfy 0 <= low < target < 1");
+    }
+    shrink_load_factor = low_load_factor;
+    shrink_target_load = target_load_factor;
+}
+
+template <typename t_key, typename t_value>
+size_t hash_table<t_key, t_value>::memory_usage() const
+{
+    size_t bytes = sizeof(*this) + buckets.get_length() * sizeof(list_sequence<entry<t_key, t_value>>);
+    bytes += static_cast<size_t>(count) * (sizeof(entry<t_key, t_value>) + chain_node_overhead);
+    if constexpr (has_heap_storage<t_key> || has_heap_storage<t_value>)
+    {
+        for (int i = 0; i < buckets.get_length(); i++)
+        {
+            for (int j = 0; j < buckets[i].get_length(); j++)
+            {
+                bytes += heap_size(buckets[i].get(j).key) + heap_size(buckets[i].get(j).value);
+            }
+        }
+    }
+    return bytes;
+}
+
 template <typename t_key, typename t_value>
 array_sequence<int> hash_table<t_key, t_value>::get_bucket_distribution() const
 {
@@ -288,11 +388,13 @@ hash_table<t_key, t_value> &hash_table<t_key, t_value>::filter(std::function<boo
         {
             if (!predicate(buckets[i].get(j).value))
             {
-                this->del(buckets[i].get(j).key);
+                buckets[i].remove_at(j);
+                count--;
             }
         }   
     }
 
+    shrink_if_needed();
     return *this;
 } 
 
@@ -329,4 +431,125 @@ shared_ptr<entry<t_key, t_value>> hash_table<t_key, t_value>::find_in_bucket(int
         }
     }
     return shared_ptr<entry<t_key, t_value>>();
-}
\ No newline at end of file
+}
+
+template <typename t_key, typename t_value>
+int hash_table<t_key, t_value>::bucket_index(const t_key &key) const
+{
+    int index;
+    if (mode == hash_mode::direct)
+    {
+        index = static_cast<int>(static_cast<uint32_t>(hash_function(key)) % static_cast<uint32_t>(capacity));
+    }
+    else
+    {
+        uint64_t hash = mode == hash_mode::fallback ? fallback_hash(key) : static_cast<uint32_t>(hash_function(key));
+        index = static_cast<int>(mix64(hash ^ seed) % static_cast<uint64_t>(capacity));
+    }
+
+    if (fold_capacity > 0 && index >= buckets.get_length())
+    {
+        index -= fold_capacity;
+    }
+    return index;
+}
+
+template <typename t_key, typename t_value>
+uint64_t hash_table<t_key, t_value>::fallback_hash(const t_key &key) const
+{
+    if constexpr (has_fallback_hash)
+    {
+        return static_cast<uint64_t>(std::hash<t_key>{}(key));
+    }
+    else
+    {
+        return static_cast<uint32_t>(hash_function(key));
+    }
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::shrink_if_needed()
+{
+    if (fold_capacity == 0)
+    {
+        if (shrink_load_factor <= 0.0 || capacity / 2 < min_shrink_capacity ||
+            get_load_factor() >= shrink_load_factor || count > shrink_target_load * (capacity / 2))
+        {
+            return;
+        }
+        if (capacity % 2 != 0)
+        {
+            int half = (capacity + 1) / 2;
+            redistribute(half + half % 2);
+            return;
+        }
+        fold_capacity = capacity / 2;
+    }
+
+    for (int step = 0; step < shrink_step && buckets.get_length() > fold_capacity; step++)
+    {
+        int last = buckets.get_length() - 1;
+        for (auto &entry : buckets[last])
+        {
+            buckets[last - fold_capacity].append_element(entry);
+        }
+        buckets.remove_at(last);
+    }
+
+    if (buckets.get_length() == fold_capacity)
+    {
+        capacity = fold_capacity;
+        fold_capacity = 0;
+    }
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::guard_chain(int index)
+{
+    if (chain_limit > 0 && buckets[index].get_length() > chain_limit && count >= reseed_floor)
+    {
+        strengthen_hash();
+    }
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::strengthen_hash()
+{
+    reseed_count++;
+    reseed_floor = count * 2;
+    seed = mix64(seed + 0x9e3779b97f4a7c15ULL * reseed_count);
+
+    if (mode == hash_mode::direct)
+    {
+        mode = hash_mode::seeded;
+        redistribute(capacity);
+        if (get_max_chain_length() <= chain_limit || !has_fallback_hash)
+        {
+            return;
+        }
+    }
+
+    if (has_fallback_hash)
+    {
+        mode = hash_mode::fallback;
+    }
+    redistribute(capacity);
+}
+
+template <typename t_key, typename t_value>
+void hash_table<t_key, t_value>::redistribute(int new_capacity)
+{
+    array_sequence<list_sequence<entry<t_key, t_value>>> old_buckets = buckets;
+    buckets.clear();
+    buckets = array_sequence<list_sequence<entry<t_key, t_value>>>(new_capacity);
+    capacity = new_capacity;
+    fold_capacity = 0;
+
+    for (int i = 0; i < old_buckets.get_length(); i++)
+    {
+        for (auto &entry : old_buckets[i])
+        {
+            buckets[bucket_index(entry.key)].append_element(entry);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <functional>
+
+struct hash_report
+{
+    int key_count;
+    int bucket_count;
+    double chi_squared;
+    double uniformity;
+    int max_chain;
+    double mean_chain;
+    double expected_probes;
+};
+
+template <typename t_key>
+class hash_analyzer
+{
+private:
+    array_sequence<t_key> sample;
+    int bucket_count;
+
+public:
+    hash_analyzer(const array_sequence<t_key> &sample, int bucket_count);
+
+    hash_report analyze(const std::function<int(const t_key &)> &hasher) const;
+    array_sequence<hash_report> compare(const array_sequence<std::function<int(const t_key &)>> &hashers) const;
+    int select(const array_sequence<std::function<int(const t_key &)>> &hashers) const;
+
+    static hash_report summarize(const array_sequence<int> &distribution);
+};
+
+#include "hash_analyzer.tpp"
\ No newline at end of file
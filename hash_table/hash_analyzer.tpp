@@ -0,0 +1,95 @@
+#include "hash_analyzer.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+template <typename t_key>
+hash_analyzer<t_key>::hash_analyzer(const array_sequence<t_key> &sample, int bucket_count)
+    : sample(sample), bucket_count(bucket_count)
+{
+    if (bucket_count <= 0)
+    {
+        throw std::invalid_argument("Bucket count must be positive");
+    }
+}
+
+template <typename t_key>
+hash_report hash_analyzer<t_key>::analyze(const std::function<int(const t_key &)> &hasher) const
+{
+    array_sequence<int> distribution(bucket_count);
+    for (int b = 0; b < bucket_count; b++)
+    {
+        distribution[b] = 0;
+    }
+    for (int i = 0; i < sample.get_length(); i++)
+    {
+        distribution[static_cast<uint32_t>(hasher(sample.get(i))) % static_cast<uint32_t>(bucket_count)]++;
+    }
+    return summarize(distribution);
+}
+
+template <typename t_key>
+array_sequence<hash_report> hash_analyzer<t_key>::compare(const array_sequence<std::function<int(const t_key &)>> &hashers) const
+{
+    array_sequence<hash_report> reports;
+    for (int h = 0; h < hashers.get_length(); h++)
+    {
+        reports.append_element(analyze(hashers.get(h)));
+    }
+    return reports;
+}
+
+template <typename t_key>
+int hash_analyzer<t_key>::select(const array_sequence<std::function<int(const t_key &)>> &hashers) const
+{
+    if (hashers.get_length() == 0)
+    {
+        throw std::invalid_argument("No hash functions to compare");
+    }
+
+    array_sequence<hash_report> reports = compare(hashers);
+    int best = 0;
+    for (int h = 1; h < reports.get_length(); h++)
+    {
+        const hash_report &current = reports.get(h);
+        const hash_report &chosen = reports.get(best);
+        if (current.expected_probes < chosen.expected_probes ||
+            (current.expected_probes == chosen.expected_probes && current.max_chain < chosen.max_chain))
+        {
+            best = h;
+        }
+    }
+    return best;
+}
+
+template <typename t_key>
+hash_report hash_analyzer<t_key>::summarize(const array_sequence<int> &distribution)
+{
+    hash_report report{0, distribution.get_length(), 0.0, 0.0, 0, 0.0, 0.0};
+    int used = 0;
+    double probes = 0.0;
+    for (int b = 0; b < distribution.get_length(); b++)
+    {
+        int length = distribution.get(b);
+        report.key_count += length;
+        report.max_chain = length > report.max_chain ? length : report.max_chain;
+        used += length > 0 ? 1 : 0;
+        probes += static_cast<double>(length) * (length + 1) / 2.0;
+    }
+
+    if (report.key_count == 0 || report.bucket_count == 0)
+    {
+        return report;
+    }
+
+    double expected = static_cast<double>(report.key_count) / report.bucket_count;
+    for (int b = 0; b < distribution.get_length(); b++)
+    {
+        double delta = distribution.get(b) - expected;
+        report.chi_squared += delta * delta / expected;
+    }
+
+    report.uniformity = report.bucket_count > 1 ? report.chi_squared / (report.bucket_count - 1) : 1.0;
+    report.mean_chain = static_cast<double>(report.key_count) / used;
+    report.expected_probes = probes / report.key_count;
+    return report;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+constexpr uint64_t mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+constexpr uint32_t fast_range32(uint32_t x, uint32_t range)
+{
+    return static_cast<uint32_t>((static_cast<uint64_t>(x) * range) >> 32);
+}
\ No newline at end of file
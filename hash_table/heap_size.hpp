@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+template <typename T>
+size_t heap_size(const T &value)
+{
+    if constexpr (requires { { value.memory_usage() } -> std::convertible_to<size_t>; })
+    {
+        return value.memory_usage() - sizeof(T);
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T>
+constexpr bool has_heap_storage = !std::is_trivially_copyable_v<T>;
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+template <typename t_func>
+void run_parallel(int tasks, int threads, t_func func)
+{
+    int workers = std::min(tasks, threads);
+    if (workers <= 1)
+    {
+        for (int i = 0; i < tasks; i++)
+        {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<int> next(0);
+    std::vector<std::exception_ptr> errors(workers);
+    std::vector<std::thread> pool;
+    for (int w = 0; w < workers; w++)
+    {
+        pool.emplace_back([&, w]()
+        {
+            try
+            {
+                for (int i = next++; i < tasks; i = next++)
+                {
+                    func(i);
+                }
+            }
+            catch (...)
+            {
+                errors[w] = std::current_exception();
+                next = tasks;
+            }
+        });
+    }
+    for (auto &worker : pool)
+    {
+        worker.join();
+    }
+    for (const auto &error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "i_dictionary.hpp"
+#include "entry.hpp"
+#include "hash_mix.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+template <typename t_key, typename t_value> class separated_table_iterator;
+
+template <typename t_key, typename t_value>
+class separated_table : public i_dictionary<t_key, t_value>
+{
+public:
+    struct index_slot
+    {
+        uint32_t fingerprint;
+        uint32_t handle;
+    };
+
+private:
+    static constexpr int chunk_bits = 10;
+    static constexpr uint32_t chunk_size = uint32_t(1) << chunk_bits;
+    static constexpr uint32_t empty_fingerprint = 0;
+    static constexpr double max_load_factor = 0.75;
+
+    array_sequence<index_slot> index;
+    array_sequence<entry<t_key, t_value> *> chunks;
+    array_sequence<uint32_t> free_handles;
+    uint32_t next_handle;
+    int count;
+    int shift;
+
+    std::function<size_t(const t_key &)> hash_function;
+
+public:
+    separated_table(const std::function<size_t(const t_key &)> &hash_function = std::hash<t_key>(), int capacity = 64);
+    ~separated_table() override;
+
+    separated_table(const separated_table &) = delete;
+    separated_table &operator=(const separated_table &) = delete;
+
+    int get_count() const override;
+    int get_capacity() const override;
+
+    size_t erase(const t_key &key);
+
+    const t_value &get(const t_key &key) const override;
+
+    separated_table<t_key, t_value> &set(const t_key &key, const t_value &value);
+    separated_table<t_key, t_value> &del(const t_key &key);
+    separated_table<t_key, t_value> &rehash(int new_capacity);
+
+    void add(const t_key &key, const t_value &value) override;
+    void remove(const t_key &key) override;
+
+    bool contains_key(const t_key &key) const override;
+
+    double get_load_factor() const;
+    size_t get_index_bytes() const;
+
+    i_iterator<t_key> *get_keys_iterator() const override;
+
+private:
+    uint32_t fingerprint_of(const t_key &key) const;
+    int home_of(uint32_t fingerprint) const;
+    int find(const t_key &key, uint32_t fingerprint) const;
+
+    entry<t_key, t_value> &record(uint32_t handle);
+    const entry<t_key, t_value> &record(uint32_t handle) const;
+
+    uint32_t allocate(const t_key &key, const t_value &value);
+    void place(const index_slot &slot);
+
+    static int slot_count_for(int capacity);
+
+    friend class separated_table_iterator<t_key, t_value>;
+};
+
+#include "separated_table.tpp"
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "separated_table.hpp"
+#include "separated_table_iterator.hpp"
+#include <bit>
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+separated_table<t_key, t_value>::separated_table(const std::function<size_t(const t_key &)> &hash_func, int capacity)
+    : next_handle(0), count(0), shift(0), hash_function(hash_func)
+{
+    if (capacity < 0)
+    {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+
+    int slot_count = slot_count_for(capacity);
+    index = array_sequence<index_slot>(slot_count);
+    for (int i = 0; i < slot_count; i++)
+    {
+        index[i] = index_slot{empty_fingerprint, 0};
+    }
+    shift = 32 - std::countr_zero(static_cast<uint32_t>(slot_count));
+}
+
+template <typename t_key, typename t_value>
+separated_table<t_key, t_value>::~separated_table()
+{
+    for (int c = 0; c < chunks.get_length(); c++)
+    {
+        delete[] chunks[c];
+    }
+}
+
+template <typename t_key, typename t_value>
+int separated_table<t_key, t_value>::get_count() const
+{
+    return count;
+}
+
+template <typename t_key, typename t_value>
+int separated_table<t_key, t_value>::get_capacity() const
+{
+    return index.get_length();
+}
+
+template <typename t_key, typename t_value>
+size_t separated_table<t_key, t_value>::erase(const t_key &key)
+{
+    int position = find(key, fingerprint_of(key));
+    if (position < 0)
+    {
+        return 0;
+    }
+
+    uint32_t handle = index[position].handle;
+    record(handle) = entry<t_key, t_value>();
+    free_handles.append_element(handle);
+
+    int mask = index.get_length() - 1;
+    int hole = position;
+    for (int next = (hole + 1) & mask; index[next].fingerprint != empty_fingerprint; next = (next + 1) & mask)
+    {
+        int home = home_of(index[next].fingerprint);
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            index[hole] = index[next];
+            hole = next;
+        }
+    }
+    index[hole] = index_slot{empty_fingerprint, 0};
+    count--;
+    return 1;
+}
+
+template <typename t_key, typename t_value>
+const t_value &separated_table<t_key, t_value>::get(const t_key &key) const
+{
+    int position = find(key, fingerprint_of(key));
+    if (position < 0)
+    {
+        throw std::out_of_range("Key not found");
+    }
+    return record(index[position].handle).value;
+}
+
+template <typename t_key, typename t_value>
+separated_table<t_key, t_value> &separated_table<t_key, t_value>::set(const t_key &key, const t_value &value)
+{
+    uint32_t fingerprint = fingerprint_of(key);
+    int position = find(key, fingerprint);
+    if (position >= 0)
+    {
+        record(index[position].handle).value = value;
+        return *this;
+    }
+
+    if (count + 1 > max_load_factor * index.get_length())
+    {
+        rehash(index.get_length() * 2);
+    }
+
+    place(index_slot{fingerprint, allocate(key, value)});
+    count++;
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+separated_table<t_key, t_value> &separated_table<t_key, t_value>::del(const t_key &key)
+{
+    erase(key);
+
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+separated_table<t_key, t_value> &separated_table<t_key, t_value>::rehash(int new_capacity)
+{
+    if (new_capacity < count)
+    {
+        throw std::invalid_argument("Capacity must be bigger than count");
+    }
+
+    int slot_count = slot_count_for(new_capacity);
+    while (count > max_load_factor * slot_count)
+    {
+        slot_count *= 2;
+    }
+
+    array_sequence<index_slot> old_index = index;
+    index = array_sequence<index_slot>(slot_count);
+    for (int i = 0; i < slot_count; i++)
+    {
+        index[i] = index_slot{empty_fingerprint, 0};
+    }
+    shift = 32 - std::countr_zero(static_cast<uint32_t>(slot_count));
+
+    for (int i = 0; i < old_index.get_length(); i++)
+    {
+        if (old_index[i].fingerprint != empty_fingerprint)
+        {
+            place(old_index[i]);
+        }
+    }
+    return *this;
+}
+
+template <typename t_key, typename t_value>
+void separated_table<t_key, t_value>::add(const t_key &key, const t_value &value)
+{
+    this->set(key, value);
+}
+
+template <typename t_key, typename t_value>
+void separated_table<t_key, t_value>::remove(const t_key &key)
+{
+    if (erase(key) == 0)
+    {
+        throw std::out_of_range("Key not found");
+    }
+}
+
+template <typename t_key, typename t_value>
+bool separated_table<t_key, t_value>::contains_key(const t_key &key) const
+{
+    return find(key, fingerprint_of(key)) >= 0;
+}
+
+template <typename t_key, typename t_value>
+double separated_table<t_key, t_value>::get_load_factor() const
+{
+    return static_cast<double>(count) / index.get_length();
+}
+
+template <typename t_key, typename t_value>
+size_t separated_table<t_key, t_value>::get_index_bytes() const
+{
+    return index.get_length() * sizeof(index_slot);
+}
+
+template <typename t_key, typename t_value>
+i_iterator<t_key> *separated_table<t_key, t_value>::get_keys_iterator() const
+{
+    return new separated_table_iterator<t_key, t_value>(*this);
+}
+
+template <typename t_key, typename t_value>
+uint32_t separated_table<t_key, t_value>::fingerprint_of(const t_key &key) const
+{
+    uint32_t fingerprint = static_cast<uint32_t>(mix64(static_cast<uint64_t>(hash_function(key))) >> 32);
+    return fingerprint == empty_fingerprint ? 1 : fingerprint;
+}
+
+template <typename t_key, typename t_value>
+int separated_table<t_key, t_value>::home_of(uint32_t fingerprint) const
+{
+    return static_cast<int>((fingerprint * 0x9e3779b1u) >> shift);
+}
+
+template <typename t_key, typename t_value>
+int separated_table<t_key, t_value>::find(const t_key &key, uint32_t fingerprint) const
+{
+    int mask = index.get_length() - 1;
+    for (int position = home_of(fingerprint); index[position].fingerprint != empty_fingerprint; position = (position + 1) & mask)
+    {
+        if (index[position].fingerprint == fingerprint && record(index[position].handle).key == key)
+        {
+            return position;
+        }
+    }
+    return -1;
+}
+
+template <typename t_key, typename t_value>
+entry<t_key, t_value> &separated_table<t_key, t_value>::record(uint32_t handle)
+{
+    return chunks[handle >> chunk_bits][handle & (chunk_size - 1)];
+}
+
+template <typename t_key, typename t_value>
+const entry<t_key, t_value> &separated_table<t_key, t_value>::record(uint32_t handle) const
+{
+    return chunks[handle >> chunk_bits][handle & (chunk_size - 1)];
+}
+
+template <typename t_key, typename t_value>
+uint32_t separated_table<t_key, t_value>::allocate(const t_key &key, const t_value &value)
+{
+    uint32_t handle;
+    if (free_handles.get_length() > 0)
+    {
+        handle = free_handles.get(free_handles.get_length() - 1);
+        free_handles.remove_at(free_handles.get_length() - 1);
+    }
+    else
+    {
+        if ((next_handle & (chunk_size - 1)) == 0)
+        {
+            chunks.append_element(new entry<t_key, t_value>[chunk_size]);
+        }
+        handle = next_handle++;
+    }
+
+    record(handle) = entry<t_key, t_value>(key, value);
+    return handle;
+}
+
+template <typename t_key, typename t_value>
+void separated_table<t_key, t_value>::place(const index_slot &slot)
+{
+    int mask = index.get_length() - 1;
+    int position = home_of(slot.fingerprint);
+    while (index[position].fingerprint != empty_fingerprint)
+    {
+        position = (position + 1) & mask;
+    }
+    index[position] = slot;
+}
+
+template <typename t_key, typename t_value>
+int separated_table<t_key, t_value>::slot_count_for(int capacity)
+{
+    int slot_count = 8;
+    while (slot_count * max_load_factor < capacity)
+    {
+        slot_count *= 2;
+    }
+    return slot_count;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "i_iterator.hpp"
+
+template <typename t_key, typename t_value> class separated_table;
+
+template <typename t_key, typename t_value>
+class separated_table_iterator : public i_iterator<t_key>
+{
+private:
+    const separated_table<t_key, t_value> *table;
+    int current_slot;
+
+public:
+    explicit separated_table_iterator(const separated_table<t_key, t_value> &table_ref);
+
+    bool has_next() const override;
+    bool next() override;
+    bool try_get_current(t_key &element) override;
+
+    t_key get_current() const override;
+
+private:
+    int find_next_occupied(int slot) const;
+};
+
+#include "separated_table_iterator.tpp"
\ No newline at end of file
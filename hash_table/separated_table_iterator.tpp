@@ -0,0 +1,58 @@
+#include "separated_table_iterator.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+separated_table_iterator<t_key, t_value>::separated_table_iterator(const separated_table<t_key, t_value> &table_ref)
+    : table(&table_ref), current_slot(find_next_occupied(-1))
+{
+}
+
+template <typename t_key, typename t_value>
+bool separated_table_iterator<t_key, t_value>::has_next() const
+{
+    return find_next_occupied(current_slot) < table->index.get_length();
+}
+
+template <typename t_key, typename t_value>
+bool separated_table_iterator<t_key, t_value>::next()
+{
+    int slot = find_next_occupied(current_slot);
+    if (slot >= table->index.get_length())
+    {
+        return false;
+    }
+    current_slot = slot;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+bool separated_table_iterator<t_key, t_value>::try_get_current(t_key &element)
+{
+    if (current_slot >= table->index.get_length())
+    {
+        return false;
+    }
+    element = table->record(table->index[current_slot].handle).key;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+t_key separated_table_iterator<t_key, t_value>::get_current() const
+{
+    if (current_slot >= table->index.get_length())
+    {
+        throw std::out_of_range("Iterator is out of range");
+    }
+    return table->record(table->index[current_slot].handle).key;
+}
+
+template <typename t_key, typename t_value>
+int separated_table_iterator<t_key, t_value>::find_next_occupied(int slot) const
+{
+    int next = slot + 1;
+    while (next < table->index.get_length() && table->index[next].fingerprint == separated_table<t_key, t_value>::empty_fingerprint)
+    {
+        next++;
+    }
+    return next;
+}
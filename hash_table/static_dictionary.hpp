@@ -0,0 +1,70 @@
+#pragma once
+
+#include "i_readonly_dictionary.hpp"
+#include "entry.hpp"
+#include "hash_mix.hpp"
+#include "run_parallel.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+template <typename t_key, typename t_value>
+class static_dictionary : public i_readonly_dictionary<t_key, t_value>
+{
+private:
+    static constexpr int partition_size = 1 << 16;
+    static constexpr int bucket_load = 4;
+    static constexpr int max_attempts = 8;
+    static constexpr uint32_t max_pilot = 1u << 24;
+    static constexpr uint32_t direct_slot = 1u << 31;
+
+    enum class build_status
+    {
+        ok,
+        pilot_overflow,
+        duplicate_key,
+        hash_collision
+    };
+
+    array_sequence<entry<t_key, t_value>> slots;
+    array_sequence<uint32_t> pilots;
+    array_sequence<int> slot_offsets;
+    array_sequence<int> pilot_offsets;
+    int count;
+    int partition_count;
+    uint64_t seed;
+
+    std::function<size_t(const t_key &)> hash_function;
+
+public:
+    static_dictionary(const array_sequence<entry<t_key, t_value>> &entries,
+                      const std::function<size_t(const t_key &)> &hash_function = std::hash<t_key>(),
+                      int threads = 0);
+    ~static_dictionary() = default;
+
+    int get_count() const override;
+    int get_capacity() const override;
+
+    const t_value &get(const t_key &key) const override;
+
+    bool contains_key(const t_key &key) const override;
+
+    size_t memory_usage() const;
+
+    i_iterator<t_key> *get_keys_iterator() const override;
+
+private:
+    int find_slot(const t_key &key) const;
+    uint64_t key_hash(const t_key &key) const;
+    uint32_t slot_in_partition(uint64_t hash, uint32_t pilot, int partition_length) const;
+
+    build_status build(const array_sequence<entry<t_key, t_value>> &entries, int threads);
+    build_status build_partition(int partition, const std::vector<uint64_t> &hashes,
+                                 const std::vector<int> &order,
+                                 const array_sequence<entry<t_key, t_value>> &entries);
+
+    static int bucket_count_for(int partition_length);
+};
+
+#include "static_dictionary.tpp"
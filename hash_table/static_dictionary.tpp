@@ -0,0 +1,323 @@
+#include "static_dictionary.hpp"
+#include "entry_array_iterator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+template <typename t_key, typename t_value>
+static_dictionary<t_key, t_value>::static_dictionary(const array_sequence<entry<t_key, t_value>> &entries,
+                                                     const std::function<size_t(const t_key &)> &hash_func,
+                                                     int threads)
+    : count(entries.get_length()), partition_count(1), seed(0), hash_function(hash_func)
+{
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (int attempt = 0; attempt < max_attempts; attempt++)
+    {
+        seed = mix64(0x9e3779b97f4a7c15ULL * (attempt + 1));
+        build_status status = build(entries, threads);
+        if (status == build_status::ok)
+        {
+            return;
+        }
+        if (status == build_status::duplicate_key)
+        {
+            throw std::invalid_argument("Duplicate key in static dictionary");
+        }
+        if (status == build_status::hash_collision)
+        {
+            throw std::invalid_argument("Hash function maps different keys to the same value");
+        }
+    }
+
+    throw std::runtime_error("Failed to build perfect hash function");
+}
+
+template <typename t_key, typename t_value>
+int static_dictionary<t_key, t_value>::get_count() const
+{
+    return count;
+}
+
+template <typename t_key, typename t_value>
+int static_dictionary<t_key, t_value>::get_capacity() const
+{
+    return slots.get_length();
+}
+
+template <typename t_key, typename t_value>
+const t_value &static_dictionary<t_key, t_value>::get(const t_key &key) const
+{
+    int index = find_slot(key);
+    if (index < 0)
+    {
+        throw std::out_of_range("Key not found");
+    }
+    return slots[index].value;
+}
+
+template <typename t_key, typename t_value>
+bool static_dictionary<t_key, t_value>::contains_key(const t_key &key) const
+{
+    return find_slot(key) >= 0;
+}
+
+template <typename t_key, typename t_value>
+size_t static_dictionary<t_key, t_value>::memory_usage() const
+{
+    return sizeof(*this)
+        + static_cast<size_t>(slots.get_length()) * sizeof(entry<t_key, t_value>)
+        + static_cast<size_t>(pilots.get_length()) * sizeof(uint32_t)
+        + static_cast<size_t>(slot_offsets.get_length() + pilot_offsets.get_length()) * sizeof(int);
+}
+
+template <typename t_key, typename t_value>
+i_iterator<t_key> *static_dictionary<t_key, t_value>::get_keys_iterator() const
+{
+    return new entry_array_iterator<t_key, t_value>(slots);
+}
+
+template <typename t_key, typename t_value>
+int static_dictionary<t_key, t_value>::find_slot(const t_key &key) const
+{
+    if (count == 0)
+    {
+        return -1;
+    }
+
+    uint64_t hash = key_hash(key);
+    int partition = fast_range32(static_cast<uint32_t>(hash >> 32), partition_count);
+    int first_slot = slot_offsets[partition];
+    int partition_length = slot_offsets[partition + 1] - first_slot;
+    if (partition_length == 0)
+    {
+        return -1;
+    }
+
+    int first_pilot = pilot_offsets[partition];
+    int buckets = pilot_offsets[partition + 1] - first_pilot;
+    int bucket = fast_range32(static_cast<uint32_t>(hash), buckets);
+
+    int index = first_slot + slot_in_partition(hash, pilots[first_pilot + bucket], partition_length);
+    if (slots[index].key == key)
+    {
+        return index;
+    }
+    return -1;
+}
+
+template <typename t_key, typename t_value>
+uint64_t static_dictionary<t_key, t_value>::key_hash(const t_key &key) const
+{
+    return mix64(static_cast<uint64_t>(hash_function(key)) ^ seed);
+}
+
+template <typename t_key, typename t_value>
+uint32_t static_dictionary<t_key, t_value>::slot_in_partition(uint64_t hash, uint32_t pilot, int partition_length) const
+{
+    if (pilot & direct_slot)
+    {
+        return pilot & ~direct_slot;
+    }
+    return static_cast<uint32_t>(mix64(hash ^ (seed + pilot * 0x9e3779b97f4a7c15ULL)) % partition_length);
+}
+
+template <typename t_key, typename t_value>
+typename static_dictionary<t_key, t_value>::build_status
+static_dictionary<t_key, t_value>::build(const array_sequence<entry<t_key, t_value>> &entries, int threads)
+{
+    partition_count = std::max(1, count / partition_size);
+
+    std::vector<uint64_t> hashes(count);
+    std::vector<int> partition_of(count);
+    int chunk = std::max(1, (count + threads - 1) / threads);
+    run_parallel((count + chunk - 1) / chunk, threads, [&](int task)
+    {
+        int end = std::min(count, (task + 1) * chunk);
+        for (int i = task * chunk; i < end; i++)
+        {
+            hashes[i] = key_hash(entries[i].key);
+            partition_of[i] = fast_range32(static_cast<uint32_t>(hashes[i] >> 32), partition_count);
+        }
+    });
+
+    std::vector<int> starts(partition_count + 1, 0);
+    for (int i = 0; i < count; i++)
+    {
+        starts[partition_of[i] + 1]++;
+    }
+    for (int p = 0; p < partition_count; p++)
+    {
+        starts[p + 1] += starts[p];
+    }
+
+    std::vector<int> order(count);
+    std::vector<int> fill(starts.begin(), starts.end() - 1);
+    for (int i = 0; i < count; i++)
+    {
+        order[fill[partition_of[i]]++] = i;
+    }
+
+    slot_offsets = array_sequence<int>(partition_count + 1);
+    pilot_offsets = array_sequence<int>(partition_count + 1);
+    for (int p = 0; p < partition_count; p++)
+    {
+        slot_offsets[p + 1] = starts[p + 1];
+        pilot_offsets[p + 1] = pilot_offsets[p] + bucket_count_for(starts[p + 1] - starts[p]);
+    }
+
+    slots = array_sequence<entry<t_key, t_value>>(count);
+    pilots = array_sequence<uint32_t>(pilot_offsets[partition_count]);
+
+    std::atomic<int> result(static_cast<int>(build_status::ok));
+    run_parallel(partition_count, threads, [&](int partition)
+    {
+        if (result.load() != static_cast<int>(build_status::ok))
+        {
+            return;
+        }
+        build_status status = build_partition(partition, hashes, order, entries);
+        if (status != build_status::ok)
+        {
+            result.store(static_cast<int>(status));
+        }
+    });
+
+    return static_cast<build_status>(result.load());
+}
+
+template <typename t_key, typename t_value>
+typename static_dictionary<t_key, t_value>::build_status
+static_dictionary<t_key, t_value>::build_partition(int partition, const std::vector<uint64_t> &hashes,
+                                                   const std::vector<int> &order,
+                                                   const array_sequence<entry<t_key, t_value>> &entries)
+{
+    int first_slot = slot_offsets[partition];
+    int length = slot_offsets[partition + 1] - first_slot;
+    int first_pilot = pilot_offsets[partition];
+    int buckets = pilot_offsets[partition + 1] - first_pilot;
+    if (length == 0)
+    {
+        return build_status::ok;
+    }
+
+    std::vector<int> bucket_start(buckets + 1, 0);
+    std::vector<int> bucket_of(length);
+    for (int i = 0; i < length; i++)
+    {
+        bucket_of[i] = fast_range32(static_cast<uint32_t>(hashes[order[first_slot + i]]), buckets);
+        bucket_start[bucket_of[i] + 1]++;
+    }
+    for (int b = 0; b < buckets; b++)
+    {
+        bucket_start[b + 1] += bucket_start[b];
+    }
+
+    std::vector<int> members(length);
+    std::vector<int> fill(bucket_start.begin(), bucket_start.end() - 1);
+    for (int i = 0; i < length; i++)
+    {
+        members[fill[bucket_of[i]]++] = order[first_slot + i];
+    }
+
+    int max_bucket = 0;
+    for (int b = 0; b < buckets; b++)
+    {
+        auto first = members.begin() + bucket_start[b];
+        auto last = members.begin() + bucket_start[b + 1];
+        std::sort(first, last, [&](int a, int c) { return hashes[a] < hashes[c]; });
+        for (auto it = first; it + 1 < last; ++it)
+        {
+            if (hashes[*it] == hashes[*(it + 1)])
+            {
+                return entries[*it].key == entries[*(it + 1)].key ? build_status::duplicate_key
+                                                                   : build_status::hash_collision;
+            }
+        }
+        max_bucket = std::max(max_bucket, bucket_start[b + 1] - bucket_start[b]);
+    }
+
+    std::vector<int> by_size;
+    by_size.reserve(buckets);
+    for (int size = max_bucket; size >= 2; size--)
+    {
+        for (int b = 0; b < buckets; b++)
+        {
+            if (bucket_start[b + 1] - bucket_start[b] == size)
+            {
+                by_size.push_back(b);
+            }
+        }
+    }
+
+    std::vector<uint8_t> taken(length, 0);
+    std::vector<uint32_t> positions(max_bucket);
+    for (int b : by_size)
+    {
+        int size = bucket_start[b + 1] - bucket_start[b];
+        uint32_t pilot = 0;
+        for (; pilot < max_pilot; pilot++)
+        {
+            int placed = 0;
+            for (; placed < size; placed++)
+            {
+                uint32_t pos = slot_in_partition(hashes[members[bucket_start[b] + placed]], pilot, length);
+                if (taken[pos])
+                {
+                    break;
+                }
+                taken[pos] = 1;
+                positions[placed] = pos;
+            }
+            if (placed == size)
+            {
+                break;
+            }
+            for (int i = 0; i < placed; i++)
+            {
+                taken[positions[i]] = 0;
+            }
+        }
+        if (pilot == max_pilot)
+        {
+            return build_status::pilot_overflow;
+        }
+
+        pilots[first_pilot + b] = pilot;
+        for (int i = 0; i < size; i++)
+        {
+            slots[first_slot + positions[i]] = entries[members[bucket_start[b] + i]];
+        }
+    }
+
+    uint32_t free_slot = 0;
+    for (int b = 0; b < buckets; b++)
+    {
+        if (bucket_start[b + 1] - bucket_start[b] == 0)
+        {
+            pilots[first_pilot + b] = 0;
+        }
+        else if (bucket_start[b + 1] - bucket_start[b] == 1)
+        {
+            while (taken[free_slot])
+            {
+                free_slot++;
+            }
+            taken[free_slot] = 1;
+            pilots[first_pilot + b] = direct_slot | free_slot;
+            slots[first_slot + free_slot] = entries[members[bucket_start[b]]];
+        }
+    }
+
+    return build_status::ok;
+}
+
+template <typename t_key, typename t_value>
+int static_dictionary<t_key, t_value>::bucket_count_for(int partition_length)
+{
+    return std::max(1, (partition_length + bucket_load - 1) / bucket_load);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "hash_table/hash.hpp"
+#include "hash_table/hash_mix.hpp"
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+template <typename t_key>
+class mrc_estimator
+{
+private:
+    static constexpr uint64_t modulus = uint64_t(1) << 24;
+    static constexpr int min_timeline = 1024;
+
+    struct sample_state
+    {
+        int time;
+        int64_t weight;
+    };
+
+    struct sample_entry
+    {
+        uint64_t value;
+        t_key key;
+
+        bool operator<(const sample_entry &other) const { return value < other.value; }
+    };
+
+    hash_table<t_key, sample_state> last_access;
+    array_sequence<int64_t> tree;
+    array_sequence<t_key> timeline;
+    array_sequence<double> histogram;
+    std::priority_queue<sample_entry, std::vector<sample_entry>> samples;
+
+    std::function<int(const t_key &)> hash_function;
+
+    uint64_t threshold;
+    int64_t bin_width;
+    int max_samples;
+    int now;
+    double references;
+    double total_references;
+
+public:
+    explicit mrc_estimator(const std::function<int(const t_key &)> &hash_function);
+    ~mrc_estimator() = default;
+
+    void reset(double sampling_rate, int64_t bin_width, int max_samples = 0);
+    void access(const t_key &key, int64_t weight = 1);
+
+    bool is_enabled() const;
+    double get_sampling_rate() const;
+    double get_reference_count() const;
+    double miss_ratio(int64_t capacity) const;
+
+    array_sequence<double> curve(const array_sequence<int64_t> &capacities) const;
+
+private:
+    uint64_t sample_value(const t_key &key) const;
+    int64_t prefix_weight(int time) const;
+
+    void add_weight(int time, int64_t weight);
+    void record_distance(int64_t distance);
+    void drop_largest_samples();
+    void compact();
+};
+
+#include "mrc_estimator.tpp"
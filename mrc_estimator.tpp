@@ -0,0 +1,217 @@
+#include "mrc_estimator.hpp"
+#include <stdexcept>
+
+template <typename t_key>
+mrc_estimator<t_key>::mrc_estimator(const std::function<int(const t_key &)> &hash_func)
+    : last_access(hash_func), hash_function(hash_func), threshold(0), bin_width(1), max_samples(0), now(0), references(0.0), total_references(0.0)
+{
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::reset(double sampling_rate, int64_t bin_width, int max_samples)
+{
+    if (sampling_rate < 0.0 || sampling_rate > 1.0)
+    {
+        throw std::invalid_argument("Sampling rate must be in [0, 1]");
+    }
+    if (bin_width <= 0)
+    {
+        throw std::invalid_argument("Bin width must be positive");
+    }
+
+    last_access = hash_table<t_key, sample_state>(hash_function);
+    tree = array_sequence<int64_t>();
+    timeline = array_sequence<t_key>();
+    histogram = array_sequence<double>();
+    samples = std::priority_queue<sample_entry, std::vector<sample_entry>>();
+
+    threshold = static_cast<uint64_t>(sampling_rate * modulus);
+    this->bin_width = bin_width;
+    this->max_samples = max_samples;
+    now = 0;
+    references = 0.0;
+    total_references = 0.0;
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::access(const t_key &key, int64_t weight)
+{
+    if (threshold == 0)
+    {
+        return;
+    }
+
+    total_references += 1.0;
+    uint64_t value = sample_value(key);
+    if (value >= threshold)
+    {
+        return;
+    }
+
+    if (now == timeline.get_length())
+    {
+        compact();
+    }
+
+    references += 1.0;
+    if (last_access.contains_key(key))
+    {
+        sample_state state = last_access.get(key);
+        int64_t others = prefix_weight(now - 1) - prefix_weight(state.time);
+        add_weight(state.time, -state.weight);
+        record_distance(static_cast<int64_t>(others * (static_cast<double>(modulus) / threshold)) + weight);
+    }
+    else
+    {
+        samples.push(sample_entry{value, key});
+    }
+
+    timeline[now] = key;
+    add_weight(now, weight);
+    last_access.set(key, sample_state{now, weight});
+    now++;
+
+    if (max_samples > 0 && last_access.get_count() > max_samples)
+    {
+        drop_largest_samples();
+    }
+}
+
+template <typename t_key>
+bool mrc_estimator<t_key>::is_enabled() const
+{
+    return threshold != 0;
+}
+
+template <typename t_key>
+double mrc_estimator<t_key>::get_sampling_rate() const
+{
+    return static_cast<double>(threshold) / modulus;
+}
+
+template <typename t_key>
+double mrc_estimator<t_key>::get_reference_count() const
+{
+    return references;
+}
+
+template <typename t_key>
+double mrc_estimator<t_key>::miss_ratio(int64_t capacity) const
+{
+    double expected = total_references * get_sampling_rate();
+    if (references == 0.0 || expected == 0.0)
+    {
+        return 1.0;
+    }
+
+    double hits = expected - references;
+    for (int b = 0; b < histogram.get_length() && (b + 1) * bin_width - 1 <= capacity; b++)
+    {
+        hits += histogram[b];
+    }
+    double ratio = 1.0 - hits / expected;
+    return ratio < 0.0 ? 0.0 : (ratio > 1.0 ? 1.0 : ratio);
+}
+
+template <typename t_key>
+array_sequence<double> mrc_estimator<t_key>::curve(const array_sequence<int64_t> &capacities) const
+{
+    array_sequence<double> result;
+    for (int i = 0; i < capacities.get_length(); i++)
+    {
+        result.append_element(miss_ratio(capacities.get(i)));
+    }
+    return result;
+}
+
+template <typename t_key>
+uint64_t mrc_estimator<t_key>::sample_value(const t_key &key) const
+{
+    return mix64(static_cast<uint64_t>(hash_function(key))) % modulus;
+}
+
+template <typename t_key>
+int64_t mrc_estimator<t_key>::prefix_weight(int time) const
+{
+    int64_t sum = 0;
+    for (int i = time + 1; i > 0; i -= i & -i)
+    {
+        sum += tree[i];
+    }
+    return sum;
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::add_weight(int time, int64_t weight)
+{
+    for (int i = time + 1; i < tree.get_length(); i += i & -i)
+    {
+        tree[i] += weight;
+    }
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::record_distance(int64_t distance)
+{
+    int bin = static_cast<int>(distance / bin_width);
+    while (histogram.get_length() <= bin)
+    {
+        histogram.append_element(0.0);
+    }
+    histogram[bin] += 1.0;
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::drop_largest_samples()
+{
+    while (last_access.get_count() > max_samples && !samples.empty())
+    {
+        uint64_t value = samples.top().value;
+        while (!samples.empty() && samples.top().value == value)
+        {
+            t_key key = samples.top().key;
+            samples.pop();
+            sample_state state = last_access.get(key);
+            add_weight(state.time, -state.weight);
+            last_access.erase(key);
+        }
+
+        double scale = static_cast<double>(value) / threshold;
+        for (int b = 0; b < histogram.get_length(); b++)
+        {
+            histogram[b] *= scale;
+        }
+        references *= scale;
+        threshold = value;
+    }
+}
+
+template <typename t_key>
+void mrc_estimator<t_key>::compact()
+{
+    int live = last_access.get_count();
+    int size = live * 2 > min_timeline ? live * 2 : min_timeline;
+
+    array_sequence<t_key> old_timeline = timeline;
+    timeline = array_sequence<t_key>(size);
+    tree = array_sequence<int64_t>(size + 1);
+    for (int i = 0; i <= size; i++)
+    {
+        tree[i] = 0;
+    }
+
+    int next = 0;
+    for (int t = 0; t < now; t++)
+    {
+        const t_key &key = old_timeline[t];
+        if (last_access.contains_key(key) && last_access.get(key).time == t)
+        {
+            sample_state state = last_access.get(key);
+            timeline[next] = key;
+            last_access.set(key, sample_state{next, state.weight});
+            add_weight(next, state.weight);
+            next++;
+        }
+    }
+    now = next;
+}
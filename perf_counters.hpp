@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+enum class perf_event
+{
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    branch_misses,
+    dtlb_misses
+};
+
+class perf_counters
+{
+public:
+    static constexpr int event_count = 6;
+
+private:
+    int descriptors[event_count];
+    double values[event_count];
+    bool measured[event_count];
+
+public:
+    explicit perf_counters(bool enabled = true);
+    ~perf_counters();
+
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+
+    void start();
+    void stop();
+
+    bool is_available() const;
+    bool is_available(perf_event event) const;
+
+    double get(perf_event event) const;
+    double per_op(perf_event event, int64_t operations) const;
+
+    static const char *event_name(perf_event event);
+
+private:
+    static int open_counter(perf_event event);
+};
+
+#include "perf_counters.tpp"
\ No newline at end of file
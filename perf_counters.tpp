@@ -0,0 +1,170 @@
+#include "perf_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+inline perf_counters::perf_counters(bool enabled)
+{
+    for (int i = 0; i < event_count; i++)
+    {
+        descriptors[i] = enabled ? open_counter(static_cast<perf_event>(i)) : -1;
+        values[i] = 0.0;
+        measured[i] = false;
+    }
+}
+
+inline perf_counters::~perf_counters()
+{
+#if defined(__linux__)
+    for (int i = 0; i < event_count; i++)
+    {
+        if (descriptors[i] != -1)
+        {
+            close(descriptors[i]);
+        }
+    }
+#endif
+}
+
+inline void perf_counters::start()
+{
+    for (int i = 0; i < event_count; i++)
+    {
+        measured[i] = false;
+#if defined(__linux__)
+        if (descriptors[i] != -1)
+        {
+            ioctl(descriptors[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptors[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+}
+
+inline void perf_counters::stop()
+{
+#if defined(__linux__)
+    for (int i = 0; i < event_count; i++)
+    {
+        if (descriptors[i] != -1)
+        {
+            ioctl(descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (int i = 0; i < event_count; i++)
+    {
+        uint64_t data[3];
+        if (descriptors[i] == -1 || read(descriptors[i], data, sizeof(data)) != sizeof(data) || data[2] == 0)
+        {
+            continue;
+        }
+
+        values[i] = static_cast<double>(data[0]) * (static_cast<double>(data[1]) / data[2]);
+        measured[i] = true;
+    }
+#endif
+}
+
+inline bool perf_counters::is_available() const
+{
+    for (int i = 0; i < event_count; i++)
+    {
+        if (descriptors[i] != -1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool perf_counters::is_available(perf_event event) const
+{
+    return measured[static_cast<int>(event)];
+}
+
+inline double perf_counters::get(perf_event event) const
+{
+    return measured[static_cast<int>(event)] ? values[static_cast<int>(event)] : -1.0;
+}
+
+inline double perf_counters::per_op(perf_event event, int64_t operations) const
+{
+    if (!measured[static_cast<int>(event)] || operations <= 0)
+    {
+        return -1.0;
+    }
+    return values[static_cast<int>(event)] / operations;
+}
+
+inline const char *perf_counters::event_name(perf_event event)
+{
+    switch (event)
+    {
+    case perf_event::cycles:
+        return "cycles";
+    case perf_event::instructions:
+        return "instructions";
+    case perf_event::l1d_misses:
+        return "l1d_misses";
+    case perf_event::llc_misses:
+        return "llc_misses";
+    case perf_event::branch_misses:
+        return "branch_misses";
+    case perf_event::dtlb_misses:
+        return "dtlb_misses";
+    }
+    return "unknown";
+}
+
+inline int perf_counters::open_counter(perf_event event)
+{
+#if defined(__linux__)
+    const uint64_t read_miss = uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8 | uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16;
+
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (event)
+    {
+    case perf_event::cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case perf_event::instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case perf_event::l1d_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+        break;
+    case perf_event::llc_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_LL | read_miss;
+        break;
+    case perf_event::branch_misses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    case perf_event::dtlb_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | read_miss;
+        break;
+    }
+
+    long descriptor = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return descriptor < 0 ? -1 : static_cast<int>(descriptor);
+#else
+    (void)event;
+    return -1;
+#endif
+}
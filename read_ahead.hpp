@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+class read_ahead
+{
+private:
+    static constexpr int stream_count = 8;
+    static constexpr int feedback_window = 64;
+    static constexpr int initial_depth = 4;
+
+    struct stream_state
+    {
+        int64_t last_position;
+        int64_t stride;
+        int confidence;
+        int64_t last_used;
+    };
+
+    stream_state streams[stream_count];
+
+    int max_depth;
+    int max_stride;
+    int depth_limit;
+    int64_t tick;
+
+    int window_useful;
+    int window_wasted;
+    int64_t useful_count;
+    int64_t wasted_count;
+
+public:
+    read_ahead();
+
+    void reset(int max_depth, int max_stride);
+
+    bool is_enabled() const;
+    bool on_miss(int64_t position, int64_t &stride, int &count);
+
+    void record_useful();
+    void record_wasted();
+
+    int get_depth_limit() const;
+    int64_t get_useful_count() const;
+    int64_t get_wasted_count() const;
+
+private:
+    int find_stream(int64_t position) const;
+    void adjust_depth();
+};
+
+#include "read_ahead.tpp"
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "read_ahead.hpp"
+#include <stdexcept>
+
+inline read_ahead::read_ahead()
+{
+    reset(0, 0);
+}
+
+inline void read_ahead::reset(int max_depth, int max_stride)
+{
+    if (max_depth < 0 || max_stride < 0)
+    {
+        throw std::invalid_argument("Read-ahead limits must be non-negative");
+    }
+    if (max_depth > 0 && max_stride == 0)
+    {
+        throw std::invalid_argument("Read-ahead stride limit must be positive");
+    }
+
+    for (int i = 0; i < stream_count; i++)
+    {
+        streams[i] = stream_state{-1, 0, 0, 0};
+    }
+    this->max_depth = max_depth;
+    this->max_stride = max_stride;
+    depth_limit = max_depth;
+    tick = 0;
+    window_useful = 0;
+    window_wasted = 0;
+    useful_count = 0;
+    wasted_count = 0;
+}
+
+inline bool read_ahead::is_enabled() const
+{
+    return max_depth > 0;
+}
+
+inline bool read_ahead::on_miss(int64_t position, int64_t &stride, int &count)
+{
+    if (!is_enabled())
+    {
+        return false;
+    }
+
+    tick++;
+    int s = find_stream(position);
+    if (s == -1)
+    {
+        s = 0;
+        for (int i = 1; i < stream_count; i++)
+        {
+            if (streams[i].last_used < streams[s].last_used)
+            {
+                s = i;
+            }
+        }
+        streams[s] = stream_state{position, 0, 0, tick};
+        return false;
+    }
+
+    stream_state &stream = streams[s];
+    int64_t delta = position - stream.last_position;
+    if (delta == stream.stride)
+    {
+        stream.confidence++;
+    }
+    else
+    {
+        stream.stride = delta;
+        stream.confidence = 1;
+    }
+    stream.last_position = position;
+    stream.last_used = tick;
+
+    if (stream.confidence < 2)
+    {
+        return false;
+    }
+
+    int depth = initial_depth;
+    for (int c = 2; c < stream.confidence && depth < depth_limit; c++)
+    {
+        depth *= 2;
+    }
+    stride = stream.stride;
+    count = depth < depth_limit ? depth : depth_limit;
+    stream.last_position = position + stride * count;
+    return true;
+}
+
+inline void read_ahead::record_useful()
+{
+    useful_count++;
+    window_useful++;
+    adjust_depth();
+}
+
+inline void read_ahead::record_wasted()
+{
+    wasted_count++;
+    window_wasted++;
+    adjust_depth();
+}
+
+inline int read_ahead::get_depth_limit() const
+{
+    return depth_limit;
+}
+
+inline int64_t read_ahead::get_useful_count() const
+{
+    return useful_count;
+}
+
+inline int64_t read_ahead::get_wasted_count() const
+{
+    return wasted_count;
+}
+
+inline int read_ahead::find_stream(int64_t position) const
+{
+    int best = -1;
+    int64_t best_distance = 0;
+    for (int i = 0; i < stream_count; i++)
+    {
+        if (streams[i].last_position < 0)
+        {
+            continue;
+        }
+
+        int64_t delta = position - streams[i].last_position;
+        if (delta != 0 && delta == streams[i].stride)
+        {
+            return i;
+        }
+
+        int64_t distance = delta < 0 ? -delta : delta;
+        if (distance != 0 && distance <= max_stride && (best == -1 || distance < best_distance))
+        {
+            best = i;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+inline void read_ahead::adjust_depth()
+{
+    if (window_useful + window_wasted < feedback_window)
+    {
+        return;
+    }
+
+    if (window_useful * 2 < window_wasted + window_useful)
+    {
+        depth_limit = depth_limit > 1 ? depth_limit / 2 : 1;
+    }
+    else if (window_useful * 4 > (window_wasted + window_useful) * 3)
+    {
+        depth_limit = depth_limit * 2 < max_depth ? depth_limit * 2 : max_depth;
+    }
+    window_useful = 0;
+    window_wasted = 0;
+}
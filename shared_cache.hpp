@@ -0,0 +1,113 @@
+#pragma once
+
+#include "hash_table/entry.hpp"
+#include "file_stream/positional_reader.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+template <typename t_key, typename t_value>
+class shared_cache
+{
+    static_assert(std::is_trivially_copyable_v<t_key> && std::is_trivially_copyable_v<t_value>,
+                  "Shared cache keys and values must be trivially copyable");
+
+private:
+    static constexpr uint64_t segment_magic = 0x48534843414348ULL;
+    static constexpr uint32_t segment_version = 1;
+    static constexpr int scan_batch = 1024;
+
+    struct slot
+    {
+        t_key key;
+        t_value value;
+        int32_t chain;
+        int32_t prev;
+        int32_t next;
+    };
+
+    struct segment_header
+    {
+        std::atomic<uint64_t> magic;
+        uint32_t version;
+        uint32_t key_size;
+        uint32_t value_size;
+        int32_t capacity;
+        int32_t bucket_count;
+        int32_t count;
+        int32_t free_slot;
+        int32_t head;
+        int32_t tail;
+        int64_t hit_count;
+        int64_t miss_count;
+        int64_t recoveries;
+#if defined(__linux__)
+        pthread_mutex_t mutex;
+#endif
+    };
+
+    class segment_guard
+    {
+    private:
+        const shared_cache *owner;
+
+    public:
+        explicit segment_guard(const shared_cache *owner);
+        ~segment_guard();
+    };
+
+    std::string name;
+    size_t segment_size;
+    segment_header *header;
+    int32_t *buckets;
+    slot *slots;
+
+    positional_reader<entry<t_key, t_value>> backing;
+    std::function<int(const t_key &)> hash_function;
+
+public:
+    shared_cache(const std::string &name, int capacity, const std::function<int(const t_key &)> &hash_function, const std::string &stream_path);
+    ~shared_cache();
+
+    shared_cache(const shared_cache &) = delete;
+    shared_cache &operator=(const shared_cache &) = delete;
+
+    t_value get(const t_key &key);
+    bool try_get(const t_key &key, t_value &value);
+
+    void put(const t_key &key, const t_value &value);
+    void clear();
+
+    int get_size() const;
+    int get_capacity() const;
+    int64_t get_hit_count() const;
+    int64_t get_miss_count() const;
+    int64_t get_recovery_count() const;
+
+    static void remove(const std::string &name);
+
+private:
+    static size_t layout_size(int capacity, int bucket_count);
+
+    void attach(int capacity);
+    void initialize(int capacity, int bucket_count);
+    void reset_contents() const;
+
+    int find(const t_key &key) const;
+    void insert(const t_key &key, const t_value &value);
+    void unlink_slot(int index);
+    void push_front(int index);
+    void evict_tail();
+
+    bool read_from_backing(const t_key &key, t_value &value) const;
+    int bucket_of(const t_key &key) const;
+};
+
+#include "shared_cache.tpp"
\ No newline at end of file
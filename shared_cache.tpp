@@ -0,0 +1,421 @@
+#include "shared_cache.hpp"
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+template <typename t_key, typename t_value>
+shared_cache<t_key, t_value>::segment_guard::segment_guard(const shared_cache *owner)
+    : owner(owner)
+{
+#if defined(__linux__)
+    int result = pthread_mutex_lock(&owner->header->mutex);
+    if (result == EOWNERDEAD)
+    {
+        owner->reset_contents();
+        owner->header->recoveries++;
+        pthread_mutex_consistent(&owner->header->mutex);
+    }
+    else if (result != 0)
+    {
+        throw std::runtime_error("Cannot lock shared memory segment: " + owner->name);
+    }
+#endif
+}
+
+template <typename t_key, typename t_value>
+shared_cache<t_key, t_value>::segment_guard::~segment_guard()
+{
+#if defined(__linux__)
+    pthread_mutex_unlock(&owner->header->mutex);
+#endif
+}
+
+template <typename t_key, typename t_value>
+shared_cache<t_key, t_value>::shared_cache(const std::string &name, int capacity, const std::function<int(const t_key &)> &hash_func, const std::string &stream_path)
+    : name(name.empty() || name[0] != '/' ? "/" + name : name), segment_size(0), header(nullptr), buckets(nullptr), slots(nullptr),
+      backing(stream_path), hash_function(hash_func)
+{
+    if (capacity <= 0)
+    {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+    attach(capacity);
+}
+
+template <typename t_key, typename t_value>
+shared_cache<t_key, t_value>::~shared_cache()
+{
+#if defined(__linux__)
+    if (header)
+    {
+        munmap(header, segment_size);
+    }
+#endif
+}
+
+template <typename t_key, typename t_value>
+t_value shared_cache<t_key, t_value>::get(const t_key &key)
+{
+    t_value value;
+    if (try_get(key, value))
+    {
+        return value;
+    }
+
+    if (!read_from_backing(key, value))
+    {
+        throw std::out_of_range("Key not found in cache or backing store");
+    }
+
+    segment_guard guard(this);
+    int index = find(key);
+    if (index != -1)
+    {
+        unlink_slot(index);
+        push_front(index);
+        return slots[index].value;
+    }
+    insert(key, value);
+    return value;
+}
+
+template <typename t_key, typename t_value>
+bool shared_cache<t_key, t_value>::try_get(const t_key &key, t_value &value)
+{
+    segment_guard guard(this);
+    int index = find(key);
+    if (index == -1)
+    {
+        header->miss_count++;
+        return false;
+    }
+
+    header->hit_count++;
+    unlink_slot(index);
+    push_front(index);
+    value = slots[index].value;
+    return true;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::put(const t_key &key, const t_value &value)
+{
+    segment_guard guard(this);
+    insert(key, value);
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::clear()
+{
+    segment_guard guard(this);
+    reset_contents();
+}
+
+template <typename t_key, typename t_value>
+int shared_cache<t_key, t_value>::get_size() const
+{
+    segment_guard guard(this);
+    return header->count;
+}
+
+template <typename t_key, typename t_value>
+int shared_cache<t_key, t_value>::get_capacity() const
+{
+    return header->capacity;
+}
+
+template <typename t_key, typename t_value>
+int64_t shared_cache<t_key, t_value>::get_hit_count() const
+{
+    segment_guard guard(this);
+    return header->hit_count;
+}
+
+template <typename t_key, typename t_value>
+int64_t shared_cache<t_key, t_value>::get_miss_count() const
+{
+    segment_guard guard(this);
+    return header->miss_count;
+}
+
+template <typename t_key, typename t_value>
+int64_t shared_cache<t_key, t_value>::get_recovery_count() const
+{
+    segment_guard guard(this);
+    return header->recoveries;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::remove(const std::string &name)
+{
+#if defined(__linux__)
+    shm_unlink((name.empty() || name[0] != '/' ? "/" + name : name).c_str());
+#else
+    (void)name;
+#endif
+}
+
+template <typename t_key, typename t_value>
+size_t shared_cache<t_key, t_value>::layout_size(int capacity, int bucket_count)
+{
+    size_t buckets_offset = (sizeof(segment_header) + 63) / 64 * 64;
+    size_t slots_offset = (buckets_offset + sizeof(int32_t) * bucket_count + alignof(slot) - 1) / alignof(slot) * alignof(slot);
+    return slots_offset + sizeof(slot) * capacity;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::attach(int capacity)
+{
+#if defined(__linux__)
+    int bucket_count = 2;
+    while (bucket_count < capacity * 2)
+    {
+        bucket_count *= 2;
+    }
+    segment_size = layout_size(capacity, bucket_count);
+
+    int descriptor = shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+    if (descriptor == -1)
+    {
+        throw std::runtime_error("Cannot open shared memory segment: " + name);
+    }
+
+    struct stat info;
+    if (flock(descriptor, LOCK_EX) != 0 || fstat(descriptor, &info) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error("Cannot lock shared memory segment: " + name);
+    }
+
+    bool initialized = false;
+    if (static_cast<size_t>(info.st_size) >= sizeof(segment_header))
+    {
+        void *probe = mmap(nullptr, sizeof(segment_header), PROT_READ, MAP_SHARED, descriptor, 0);
+        if (probe != MAP_FAILED)
+        {
+            initialized = static_cast<segment_header *>(probe)->magic.load(std::memory_order_acquire) == segment_magic;
+            munmap(probe, sizeof(segment_header));
+        }
+    }
+    if (initialized && static_cast<size_t>(info.st_size) != segment_size)
+    {
+        close(descriptor);
+        throw std::runtime_error("Shared memory segment layout mismatch: " + name);
+    }
+    if (!initialized && ftruncate(descriptor, static_cast<off_t>(segment_size)) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error("Cannot size shared memory segment: " + name);
+    }
+
+    void *base = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (base == MAP_FAILED)
+    {
+        close(descriptor);
+        throw std::runtime_error("Cannot map shared memory segment: " + name);
+    }
+
+    char *bytes = static_cast<char *>(base);
+    size_t buckets_offset = (sizeof(segment_header) + 63) / 64 * 64;
+    header = static_cast<segment_header *>(base);
+    buckets = reinterpret_cast<int32_t *>(bytes + buckets_offset);
+    slots = reinterpret_cast<slot *>(bytes + segment_size - sizeof(slot) * capacity);
+
+    if (!initialized)
+    {
+        initialize(capacity, bucket_count);
+    }
+    flock(descriptor, LOCK_UN);
+    close(descriptor);
+
+    if (header->version != segment_version ||
+        header->key_size != sizeof(t_key) || header->value_size != sizeof(t_value) ||
+        header->capacity != capacity || header->bucket_count != bucket_count)
+    {
+        munmap(header, segment_size);
+        header = nullptr;
+        throw std::runtime_error("Shared memory segment layout mismatch: " + name);
+    }
+#else
+    (void)capacity;
+    throw std::runtime_error("Shared memory segments are not supported on this platform");
+#endif
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::initialize(int capacity, int bucket_count)
+{
+#if defined(__linux__)
+    header->version = segment_version;
+    header->key_size = sizeof(t_key);
+    header->value_size = sizeof(t_value);
+    header->capacity = capacity;
+    header->bucket_count = bucket_count;
+    header->hit_count = 0;
+    header->miss_count = 0;
+    header->recoveries = 0;
+
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&header->mutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+
+    reset_contents();
+    header->magic.store(segment_magic, std::memory_order_release);
+#else
+    (void)capacity;
+    (void)bucket_count;
+#endif
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::reset_contents() const
+{
+    for (int b = 0; b < header->bucket_count; b++)
+    {
+        buckets[b] = -1;
+    }
+    for (int i = 0; i < header->capacity; i++)
+    {
+        slots[i].next = i + 1 < header->capacity ? i + 1 : -1;
+    }
+    header->free_slot = 0;
+    header->count = 0;
+    header->head = -1;
+    header->tail = -1;
+}
+
+template <typename t_key, typename t_value>
+int shared_cache<t_key, t_value>::find(const t_key &key) const
+{
+    for (int index = buckets[bucket_of(key)]; index != -1; index = slots[index].chain)
+    {
+        if (slots[index].key == key)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::insert(const t_key &key, const t_value &value)
+{
+    int index = find(key);
+    if (index != -1)
+    {
+        slots[index].value = value;
+        unlink_slot(index);
+        push_front(index);
+        return;
+    }
+
+    if (header->free_slot == -1)
+    {
+        evict_tail();
+    }
+
+    index = header->free_slot;
+    header->free_slot = slots[index].next;
+
+    int bucket = bucket_of(key);
+    slots[index].key = key;
+    slots[index].value = value;
+    slots[index].chain = buckets[bucket];
+    buckets[bucket] = index;
+    push_front(index);
+    header->count++;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::unlink_slot(int index)
+{
+    int prev = slots[index].prev;
+    int next = slots[index].next;
+    if (prev != -1)
+    {
+        slots[prev].next = next;
+    }
+    else
+    {
+        header->head = next;
+    }
+    if (next != -1)
+    {
+        slots[next].prev = prev;
+    }
+    else
+    {
+        header->tail = prev;
+    }
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::push_front(int index)
+{
+    slots[index].prev = -1;
+    slots[index].next = header->head;
+    if (header->head != -1)
+    {
+        slots[header->head].prev = index;
+    }
+    else
+    {
+        header->tail = index;
+    }
+    header->head = index;
+}
+
+template <typename t_key, typename t_value>
+void shared_cache<t_key, t_value>::evict_tail()
+{
+    int victim = header->tail;
+    unlink_slot(victim);
+
+    int32_t *link = &buckets[bucket_of(slots[victim].key)];
+    while (*link != victim)
+    {
+        link = &slots[*link].chain;
+    }
+    *link = slots[victim].chain;
+
+    slots[victim].next = header->free_slot;
+    header->free_slot = victim;
+    header->count--;
+}
+
+template <typename t_key, typename t_value>
+bool shared_cache<t_key, t_value>::read_from_backing(const t_key &key, t_value &value) const
+{
+    std::vector<entry<t_key, t_value>> batch(scan_batch);
+    for (int end = backing.get_count(); end > 0; end -= scan_batch)
+    {
+        int first = end > scan_batch ? end - scan_batch : 0;
+        int read = backing.read_range(first, batch.data(), end - first);
+        for (int i = read - 1; i >= 0; i--)
+        {
+            if (batch[i].key == key)
+            {
+                value = batch[i].value;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename t_key, typename t_value>
+int shared_cache<t_key, t_value>::bucket_of(const t_key &key) const
+{
+    return static_cast<int>(static_cast<uint32_t>(hash_function(key)) & static_cast<uint32_t>(header->bucket_count - 1));
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../hash_table/hash_mix.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+
+template <typename t_key>
+class count_min_sketch
+{
+private:
+    array_sequence<uint32_t> counters;
+    int width;
+    int depth;
+    int64_t total;
+
+    std::function<int(const t_key &)> hash_function;
+
+public:
+    count_min_sketch(const std::function<int(const t_key &)> &hash_function, int width = 2048, int depth = 4);
+    ~count_min_sketch() = default;
+
+    void add(const t_key &key, uint32_t count = 1);
+    void merge(const count_min_sketch<t_key> &other);
+    void halve();
+    void reset();
+    void resize(int width, int depth);
+
+    uint32_t estimate(const t_key &key) const;
+    int64_t get_total() const;
+
+private:
+    int cell(uint64_t hash, int row) const;
+};
+
+#include "count_min_sketch.tpp"
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "count_min_sketch.hpp"
+#include <limits>
+#include <stdexcept>
+
+template <typename t_key>
+count_min_sketch<t_key>::count_min_sketch(const std::function<int(const t_key &)> &hash_func, int width, int depth)
+    : width(0), depth(0), total(0), hash_function(hash_func)
+{
+    resize(width, depth);
+}
+
+template <typename t_key>
+void count_min_sketch<t_key>::add(const t_key &key, uint32_t count)
+{
+    uint64_t hash = mix64(static_cast<uint32_t>(hash_function(key)));
+    for (int row = 0; row < depth; row++)
+    {
+        uint32_t &counter = counters[cell(hash, row)];
+        counter = counter > std::numeric_limits<uint32_t>::max() - count ? std::numeric_limits<uint32_t>::max() : counter + count;
+    }
+    total += count;
+}
+
+template <typename t_key>
+void count_min_sketch<t_key>::merge(const count_min_sketch<t_key> &other)
+{
+    if (other.width != width || other.depth != depth)
+    {
+        throw std::invalid_argument("Cannot merge sketches with different dimensions");
+    }
+
+    for (int i = 0; i < counters.get_length(); i++)
+    {
+        uint32_t count = other.counters.get(i);
+        counters[i] = counters[i] > std::numeric_limits<uint32_t>::max() - count ? std::numeric_limits<uint32_t>::max() : counters[i] + count;
+    }
+    total += other.total;
+}
+
+template <typename t_key>
+void count_min_sketch<t_key>::halve()
+{
+    for (int i = 0; i < counters.get_length(); i++)
+    {
+        counters[i] >>= 1;
+    }
+    total /= 2;
+}
+
+template <typename t_key>
+void count_min_sketch<t_key>::reset()
+{
+    counters = array_sequence<uint32_t>(width * depth);
+    for (int i = 0; i < width * depth; i++)
+    {
+        counters[i] = 0;
+    }
+    total = 0;
+}
+
+template <typename t_key>
+void count_min_sketch<t_key>::resize(int width, int depth)
+{
+    if (width <= 0 || depth <= 0)
+    {
+        throw std::invalid_argument("Sketch dimensions must be positive");
+    }
+
+    this->width = width;
+    this->depth = depth;
+    reset();
+}
+
+template <typename t_key>
+uint32_t count_min_sketch<t_key>::estimate(const t_key &key) const
+{
+    uint64_t hash = mix64(static_cast<uint32_t>(hash_function(key)));
+    uint32_t result = std::numeric_limits<uint32_t>::max();
+    for (int row = 0; row < depth; row++)
+    {
+        uint32_t counter = counters.get(cell(hash, row));
+        result = counter < result ? counter : result;
+    }
+    return result;
+}
+
+template <typename t_key>
+int64_t count_min_sketch<t_key>::get_total() const
+{
+    return total;
+}
+
+template <typename t_key>
+int count_min_sketch<t_key>::cell(uint64_t hash, int row) const
+{
+    uint32_t first = static_cast<uint32_t>(hash);
+    uint32_t second = static_cast<uint32_t>(hash >> 32) | 1u;
+    return row * width + static_cast<int>(fast_range32(first + static_cast<uint32_t>(row) * second, static_cast<uint32_t>(width)));
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../hash_table/hash_mix.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+
+template <typename t_key>
+class hyperloglog
+{
+private:
+    array_sequence<uint8_t> registers;
+    int precision;
+
+    std::function<int(const t_key &)> hash_function;
+
+public:
+    explicit hyperloglog(const std::function<int(const t_key &)> &hash_function, int precision = 14);
+    ~hyperloglog() = default;
+
+    void add(const t_key &key);
+    void merge(const hyperloglog<t_key> &other);
+    void reset();
+
+    double estimate() const;
+    int get_precision() const;
+};
+
+#include "hyperloglog.tpp"
\ No newline at end of file
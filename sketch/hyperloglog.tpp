@@ -0,0 +1,83 @@
+#include "hyperloglog.hpp"
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+template <typename t_key>
+hyperloglog<t_key>::hyperloglog(const std::function<int(const t_key &)> &hash_func, int precision)
+    : precision(precision), hash_function(hash_func)
+{
+    if (precision < 4 || precision > 18)
+    {
+        throw std::invalid_argument("HyperLogLog precision must be in [4, 18]");
+    }
+    reset();
+}
+
+template <typename t_key>
+void hyperloglog<t_key>::add(const t_key &key)
+{
+    uint64_t hash = mix64(static_cast<uint32_t>(hash_function(key)));
+    int index = static_cast<int>(hash >> (64 - precision));
+    uint64_t rest = hash << precision;
+    uint8_t rank = static_cast<uint8_t>(rest == 0 ? 64 - precision + 1 : std::countl_zero(rest) + 1);
+    if (rank > registers[index])
+    {
+        registers[index] = rank;
+    }
+}
+
+template <typename t_key>
+void hyperloglog<t_key>::merge(const hyperloglog<t_key> &other)
+{
+    if (other.precision != precision)
+    {
+        throw std::invalid_argument("Cannot merge sketches with different precision");
+    }
+
+    for (int i = 0; i < registers.get_length(); i++)
+    {
+        if (other.registers.get(i) > registers[i])
+        {
+            registers[i] = other.registers.get(i);
+        }
+    }
+}
+
+template <typename t_key>
+void hyperloglog<t_key>::reset()
+{
+    int size = 1 << precision;
+    registers = array_sequence<uint8_t>(size);
+    for (int i = 0; i < size; i++)
+    {
+        registers[i] = 0;
+    }
+}
+
+template <typename t_key>
+double hyperloglog<t_key>::estimate() const
+{
+    double size = registers.get_length();
+    double sum = 0.0;
+    int zeros = 0;
+    for (int i = 0; i < registers.get_length(); i++)
+    {
+        sum += std::ldexp(1.0, -registers.get(i));
+        zeros += registers.get(i) == 0;
+    }
+
+    double alpha = 0.7213 / (1.0 + 1.079 / size);
+    double raw = alpha * size * size / sum;
+    if (raw <= 2.5 * size && zeros != 0)
+    {
+        return size * std::log(size / zeros);
+    }
+    return raw;
+}
+
+template <typename t_key>
+int hyperloglog<t_key>::get_precision() const
+{
+    return precision;
+}
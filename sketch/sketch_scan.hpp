@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../file_stream/positional_reader.hpp"
+#include "../hash_table/entry.hpp"
+#include "../hash_table/run_parallel.hpp"
+#include <functional>
+#include <string>
+
+template <typename t_key, typename t_value, typename t_sketch>
+t_sketch sketch_file(const std::string &path, const std::function<t_sketch()> &make_sketch, int threads = 0);
+
+#include "sketch_scan.tpp"
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "sketch_scan.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+template <typename t_key, typename t_value, typename t_sketch>
+t_sketch sketch_file(const std::string &path, const std::function<t_sketch()> &make_sketch, int threads)
+{
+    const int read_batch = 4096;
+
+    positional_reader<entry<t_key, t_value>> input(path);
+    int count = input.get_count();
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    int chunk = std::max(read_batch, (count + threads - 1) / threads);
+    int tasks = std::max(1, (count + chunk - 1) / chunk);
+
+    std::vector<t_sketch> partials;
+    for (int t = 0; t < tasks; t++)
+    {
+        partials.push_back(make_sketch());
+    }
+
+    run_parallel(tasks, threads, [&](int t)
+    {
+        std::vector<entry<t_key, t_value>> batch(read_batch);
+        int last = std::min(count, (t + 1) * chunk);
+        for (int first = t * chunk; first < last; first += read_batch)
+        {
+            int read = input.read_range(first, batch.data(), std::min(read_batch, last - first));
+            for (int i = 0; i < read; i++)
+            {
+                partials[t].add(batch[i].key);
+            }
+        }
+    });
+
+    t_sketch result = make_sketch();
+    for (const auto &partial : partials)
+    {
+        result.merge(partial);
+    }
+    return result;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../hash_table/hash.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <cstdint>
+#include <functional>
+
+template <typename t_key>
+struct heavy_hitter
+{
+    t_key key;
+    int64_t count;
+    int64_t error;
+};
+
+template <typename t_key>
+class space_saving
+{
+private:
+    array_sequence<heavy_hitter<t_key>> counters;
+    hash_table<t_key, int> index;
+    int capacity;
+
+    std::function<int(const t_key &)> hash_function;
+
+public:
+    space_saving(const std::function<int(const t_key &)> &hash_function, int capacity);
+    ~space_saving() = default;
+
+    void add(const t_key &key, int64_t count = 1);
+    void merge(const space_saving<t_key> &other);
+    void reset();
+
+    bool contains_key(const t_key &key) const;
+    int64_t estimate(const t_key &key) const;
+    int64_t guaranteed(const t_key &key) const;
+
+    int get_count() const;
+    int get_capacity() const;
+
+    array_sequence<heavy_hitter<t_key>> top(int n) const;
+
+private:
+    int64_t floor_count() const;
+
+    void sift_up(int slot);
+    void sift_down(int slot);
+    void swap_slots(int first, int second);
+};
+
+#include "space_saving.tpp"
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "space_saving.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+template <typename t_key>
+space_saving<t_key>::space_saving(const std::function<int(const t_key &)> &hash_func, int capacity)
+    : index(hash_func, capacity * 2 + 1), capacity(capacity), hash_function(hash_func)
+{
+    if (capacity <= 0)
+    {
+        throw std::invalid_argument("Space-saving capacity must be positive");
+    }
+}
+
+template <typename t_key>
+void space_saving<t_key>::add(const t_key &key, int64_t count)
+{
+    if (index.contains_key(key))
+    {
+        int slot = index.get(key);
+        counters[slot].count += count;
+        sift_down(slot);
+        return;
+    }
+
+    if (counters.get_length() < capacity)
+    {
+        counters.append_element(heavy_hitter<t_key>{key, count, 0});
+        index.set(key, counters.get_length() - 1);
+        sift_up(counters.get_length() - 1);
+        return;
+    }
+
+    int64_t evicted = counters[0].count;
+    index.erase(counters[0].key);
+    counters[0] = heavy_hitter<t_key>{key, evicted + count, evicted};
+    index.set(key, 0);
+    sift_down(0);
+}
+
+template <typename t_key>
+void space_saving<t_key>::merge(const space_saving<t_key> &other)
+{
+    int64_t own_floor = floor_count();
+    int64_t other_floor = other.floor_count();
+
+    std::vector<heavy_hitter<t_key>> merged;
+    for (int i = 0; i < counters.get_length(); i++)
+    {
+        heavy_hitter<t_key> item = counters[i];
+        if (other.index.contains_key(item.key))
+        {
+            const heavy_hitter<t_key> &match = other.counters.get(other.index.get(item.key));
+            item.count += match.count;
+            item.error += match.error;
+        }
+        else
+        {
+            item.count += other_floor;
+            item.error += other_floor;
+        }
+        merged.push_back(item);
+    }
+    for (int i = 0; i < other.counters.get_length(); i++)
+    {
+        heavy_hitter<t_key> item = other.counters.get(i);
+        if (!index.contains_key(item.key))
+        {
+            item.count += own_floor;
+            item.error += own_floor;
+            merged.push_back(item);
+        }
+    }
+
+    std::sort(merged.begin(), merged.end(), [](const heavy_hitter<t_key> &a, const heavy_hitter<t_key> &b)
+    {
+        return a.count > b.count;
+    });
+
+    reset();
+    int kept = static_cast<int>(merged.size()) < capacity ? static_cast<int>(merged.size()) : capacity;
+    for (int i = kept - 1; i >= 0; i--)
+    {
+        counters.append_element(merged[i]);
+        index.set(merged[i].key, kept - 1 - i);
+    }
+}
+
+template <typename t_key>
+void space_saving<t_key>::reset()
+{
+    counters = array_sequence<heavy_hitter<t_key>>();
+    index = hash_table<t_key, int>(hash_function, capacity * 2 + 1);
+}
+
+template <typename t_key>
+bool space_saving<t_key>::contains_key(const t_key &key) const
+{
+    return index.contains_key(key);
+}
+
+template <typename t_key>
+int64_t space_saving<t_key>::estimate(const t_key &key) const
+{
+    return index.contains_key(key) ? counters.get(index.get(key)).count : floor_count();
+}
+
+template <typename t_key>
+int64_t space_saving<t_key>::guaranteed(const t_key &key) const
+{
+    if (!index.contains_key(key))
+    {
+        return 0;
+    }
+    const heavy_hitter<t_key> &item = counters.get(index.get(key));
+    return item.count - item.error;
+}
+
+template <typename t_key>
+int space_saving<t_key>::get_count() const
+{
+    return counters.get_length();
+}
+
+template <typename t_key>
+int space_saving<t_key>::get_capacity() const
+{
+    return capacity;
+}
+
+template <typename t_key>
+array_sequence<heavy_hitter<t_key>> space_saving<t_key>::top(int n) const
+{
+    std::vector<heavy_hitter<t_key>> sorted;
+    for (int i = 0; i < counters.get_length(); i++)
+    {
+        sorted.push_back(counters.get(i));
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const heavy_hitter<t_key> &a, const heavy_hitter<t_key> &b)
+    {
+        return a.count > b.count;
+    });
+
+    array_sequence<heavy_hitter<t_key>> result;
+    for (int i = 0; i < static_cast<int>(sorted.size()) && i < n; i++)
+    {
+        result.append_element(sorted[i]);
+    }
+    return result;
+}
+
+template <typename t_key>
+int64_t space_saving<t_key>::floor_count() const
+{
+    return counters.get_length() < capacity ? 0 : counters.get(0).count;
+}
+
+template <typename t_key>
+void space_saving<t_key>::sift_up(int slot)
+{
+    while (slot > 0)
+    {
+        int parent = (slot - 1) / 2;
+        if (counters[parent].count <= counters[slot].count)
+        {
+            return;
+        }
+        swap_slots(slot, parent);
+        slot = parent;
+    }
+}
+
+template <typename t_key>
+void space_saving<t_key>::sift_down(int slot)
+{
+    int length = counters.get_length();
+    while (true)
+    {
+        int smallest = slot;
+        int left = 2 * slot + 1;
+        int right = left + 1;
+        if (left < length && counters[left].count < counters[smallest].count)
+        {
+            smallest = left;
+        }
+        if (right < length && counters[right].count < counters[smallest].count)
+        {
+            smallest = right;
+        }
+        if (smallest == slot)
+        {
+            return;
+        }
+        swap_slots(slot, smallest);
+        slot = smallest;
+    }
+}
+
+template <typename t_key>
+void space_saving<t_key>::swap_slots(int first, int second)
+{
+    heavy_hitter<t_key> item = counters[first];
+    counters[first] = counters[second];
+    counters[second] = item;
+    index.set(counters[first].key, first);
+    index.set(counters[second].key, second);
+}
@@ -0,0 +1,441 @@
+#include <gtest/gtest.h>
+#include "cache.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+auto cache_hash = [](const int &key)
+{
+    return key & 0x7fffffff;
+};
+
+TEST(cache_test, entry_ttl)
+{
+    const std::string path = "cache_ttl_test.bin";
+    std::remove(path.c_str());
+    int64_t now = 0;
+    {
+        cache<int, int> my_cache(4, 100, cache_hash, path);
+        my_cache.set_clock([&]() { return now; });
+
+        my_cache.put(1, 10, 100);
+        my_cache.put(2, 20);
+
+        now = 99;
+        EXPECT_EQ(my_cache.get(1), 10);
+        EXPECT_EQ(my_cache.get_hit_count(), 1);
+
+        now = 100;
+        EXPECT_EQ(my_cache.get(2), 20);
+        EXPECT_EQ(my_cache.get_size(), 1);
+
+        EXPECT_EQ(my_cache.get(1), 10);
+        EXPECT_EQ(my_cache.get_miss_count(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, weighted_capacity)
+{
+    const std::string path = "cache_weight_test.bin";
+    std::remove(path.c_str());
+    {
+        cache<int, int> my_cache(100, 100, cache_hash, path);
+        my_cache.set_weigher([](const int &, const int &value) { return int64_t(value); }, 100);
+
+        my_cache.put(1, 40);
+        my_cache.put(2, 40);
+        EXPECT_EQ(my_cache.get_weight(), 80);
+
+        my_cache.put(3, 30);
+        EXPECT_EQ(my_cache.get_size(), 2);
+        EXPECT_EQ(my_cache.get_weight(), 70);
+
+        my_cache.put(4, 500);
+        EXPECT_EQ(my_cache.get_size(), 2);
+        EXPECT_EQ(my_cache.get_weight(), 70);
+        EXPECT_EQ(my_cache.get(4), 500);
+        EXPECT_EQ(my_cache.get_miss_count(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, cost_aware_eviction_keeps_expensive_entry)
+{
+    const std::string path = "cache_cost_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        stream.write(entry<int, int>(1, 10));
+        for (int i = 0; i < 5000; i++)
+        {
+            stream.write(entry<int, int>(1000 + i, i));
+        }
+        for (int i = 2; i <= 4; i++)
+        {
+            stream.write(entry<int, int>(i, i * 10));
+        }
+    }
+    {
+        cache<int, int> my_cache(3, 100, cache_hash, path);
+        my_cache.set_cost_aware(true);
+
+        my_cache.get(1);
+        my_cache.get(2);
+        my_cache.get(3);
+        my_cache.get(4);
+
+        my_cache.reset_statistics();
+        EXPECT_EQ(my_cache.get(1), 10);
+        EXPECT_EQ(my_cache.get_hit_count(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, concurrent_misses_share_one_load)
+{
+    const std::string path = "cache_single_flight_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 100000; i++)
+        {
+            stream.write(entry<int, int>(1000 + i, i));
+        }
+        stream.write(entry<int, int>(1, 10));
+    }
+    {
+        cache<int, int> my_cache(4, 100, cache_hash, path);
+        std::vector<std::thread> threads;
+        std::vector<int> values(8, 0);
+        std::vector<int> errors(8, 0);
+        for (int t = 0; t < 8; t++)
+        {
+            threads.emplace_back([&, t]()
+            {
+                values[t] = my_cache.get(1);
+                try
+                {
+                    my_cache.get(5);
+                }
+                catch (const std::out_of_range &)
+                {
+                    errors[t] = 1;
+                }
+            });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        for (int t = 0; t < 8; t++)
+        {
+            EXPECT_EQ(values[t], 10);
+            EXPECT_EQ(errors[t], 1);
+        }
+        EXPECT_EQ(my_cache.get_hit_count() + my_cache.get_miss_count(), 16);
+        EXPECT_GE(my_cache.get_miss_count() - my_cache.get_coalesced_count(), 2);
+        EXPECT_EQ(my_cache.get_size(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, put_appends_to_backing_file)
+{
+    const std::string path = "cache_append_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 200; i++)
+        {
+            stream.write(entry<int, int>(i, i * 10));
+        }
+    }
+    {
+        cache<int, int> my_cache(2, 1000, cache_hash, path);
+        my_cache.put(50, 999);
+        my_cache.put(60, 777);
+        my_cache.put(70, 555);
+
+        EXPECT_EQ(my_cache.get(50), 999);
+        EXPECT_EQ(my_cache.get(0), 0);
+        EXPECT_EQ(my_cache.get(1), 10);
+    }
+    {
+        cache<int, int> my_cache(2, 1000, cache_hash, path);
+        EXPECT_EQ(my_cache.get(0), 0);
+        EXPECT_EQ(my_cache.get(2), 20);
+        EXPECT_EQ(my_cache.get(60), 777);
+        EXPECT_EQ(my_cache.get(199), 1990);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, put_updates_entry_in_place)
+{
+    const std::string path = "cache_update_test.bin";
+    std::remove(path.c_str());
+    {
+        cache<int, int> my_cache(100, 100, cache_hash, path);
+        my_cache.set_weigher([](const int &, const int &value) { return int64_t(value); }, 100);
+
+        my_cache.put(1, 40);
+        my_cache.put(2, 40);
+        my_cache.put(1, 10);
+        EXPECT_EQ(my_cache.get_size(), 2);
+        EXPECT_EQ(my_cache.get_weight(), 50);
+
+        my_cache.put(3, 50);
+        EXPECT_EQ(my_cache.get_size(), 3);
+        EXPECT_EQ(my_cache.get(1), 10);
+
+        my_cache.put(2, 500);
+        EXPECT_EQ(my_cache.get_size(), 2);
+        EXPECT_EQ(my_cache.get_weight(), 60);
+        EXPECT_EQ(my_cache.get_miss_count(), 0);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, visit_reads_cached_value)
+{
+    const std::string path = "cache_visit_test.bin";
+    std::remove(path.c_str());
+    {
+        cache<int, int> my_cache(10, 100, cache_hash, path);
+        my_cache.put(1, 42);
+
+        const int *address = nullptr;
+        int doubled = my_cache.visit(1, [&address](const int &value)
+        {
+            address = &value;
+            return value * 2;
+        });
+        EXPECT_EQ(doubled, 84);
+
+        my_cache.visit(1, [&address](const int &value)
+        {
+            EXPECT_EQ(&value, address);
+        });
+        EXPECT_EQ(my_cache.get_hit_count(), 2);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, frequency_admission)
+{
+    const std::string path = "cache_admission_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 10; i++)
+        {
+            stream.write(entry<int, int>(1000 + i, i));
+        }
+    }
+    {
+        cache<int, int> my_cache(10, 0, cache_hash, path);
+        my_cache.enable_frequency_admission(2);
+
+        EXPECT_EQ(my_cache.get(1003), 3);
+        EXPECT_EQ(my_cache.get_size(), 0);
+        EXPECT_EQ(my_cache.get(1003), 3);
+        EXPECT_EQ(my_cache.get_size(), 1);
+        EXPECT_EQ(my_cache.get(1003), 3);
+        EXPECT_EQ(my_cache.get_hit_count(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, victim_tier_promotes_evicted_entry)
+{
+    const std::string path = "cache_victim_test.bin";
+    const std::string slab_path = "cache_victim_slab.bin";
+    std::remove(path.c_str());
+    {
+        slab_cache<int, int> tier(slab_path, 4, cache_hash);
+        cache<int, int> my_cache(2, 100, cache_hash, path);
+        my_cache.set_victim_tier(&tier);
+
+        my_cache.put(1, 10);
+        my_cache.put(2, 20);
+        my_cache.put(3, 30);
+        EXPECT_EQ(tier.get_count(), 1);
+
+        EXPECT_EQ(my_cache.get(1), 10);
+        EXPECT_EQ(my_cache.get_promoted_count(), 1);
+        EXPECT_EQ(tier.get_hit_count(), 1);
+
+        my_cache.put(2, 21);
+        EXPECT_EQ(my_cache.get(2), 21);
+        EXPECT_EQ(my_cache.get_promoted_count(), 1);
+    }
+    std::remove(path.c_str());
+    std::remove(slab_path.c_str());
+}
+
+TEST(cache_test, read_ahead_on_sequential_misses)
+{
+    const std::string path = "cache_read_ahead_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 200; i++)
+        {
+            stream.write(entry<int, int>(i, i * 10));
+        }
+    }
+    {
+        cache<int, int> my_cache(64, 1000, cache_hash, path);
+        my_cache.enable_read_ahead(16, 4);
+
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(my_cache.get(i), i * 10);
+        }
+        EXPECT_LT(my_cache.get_miss_count(), 20);
+        EXPECT_GT(my_cache.get_prefetched_count(), 80);
+        EXPECT_GT(my_cache.get_read_ahead_hit_count(), 80);
+        EXPECT_LE(my_cache.get_size(), 64);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, read_ahead_keeps_demand_entries)
+{
+    const std::string path = "cache_read_ahead_demand_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 200; i++)
+        {
+            stream.write(entry<int, int>(i, i * 10));
+        }
+    }
+    {
+        cache<int, int> my_cache(8, 1000, cache_hash, path);
+        my_cache.enable_read_ahead(8, 4);
+
+        const int hot[] = {150, 120, 170, 133};
+        for (int key : hot)
+        {
+            my_cache.get(key);
+        }
+
+        int hot_misses = 0;
+        for (int i = 0; i < 64; i++)
+        {
+            EXPECT_EQ(my_cache.get(i), i * 10);
+            for (int key : hot)
+            {
+                int misses = my_cache.get_miss_count();
+                EXPECT_EQ(my_cache.get(key), key * 10);
+                hot_misses += my_cache.get_miss_count() - misses;
+            }
+        }
+        EXPECT_EQ(hot_misses, 0);
+        EXPECT_GT(my_cache.get_prefetched_count(), 0);
+        EXPECT_LE(my_cache.get_size(), 8);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(cache_test, read_ahead_skips_stale_records)
+{
+    const std::string path = "cache_read_ahead_stale_test.bin";
+    const std::string log_path = "cache_read_ahead_stale_test.log";
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 200; i++)
+        {
+            stream.write(entry<int, int>(i, i * 10));
+        }
+    }
+    {
+        int64_t now = 0;
+        wal_stream<entry<int, int>> log(log_path);
+        cache<int, int> my_cache(64, 1000, cache_hash, path);
+        my_cache.set_clock([&]() { return now; });
+        my_cache.set_write_ahead_log(&log);
+        my_cache.enable_read_ahead(16, 4);
+
+        my_cache.put(50, 999, 5);
+        now = 10;
+        for (int i = 40; i < 50; i++)
+        {
+            EXPECT_EQ(my_cache.get(i), i * 10);
+        }
+        EXPECT_GT(my_cache.get_prefetched_count(), 0);
+        EXPECT_EQ(my_cache.get(50), 999);
+        EXPECT_EQ(my_cache.get(51), 510);
+    }
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+}
+
+TEST(cache_test, write_ahead_log_records_puts)
+{
+    const std::string path = "cache_wal_test.bin";
+    const std::string log_path = "cache_wal_test.log";
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+    {
+        wal_stream<entry<int, int>> log(log_path);
+        cache<int, int> my_cache(4, 100, cache_hash, path);
+        my_cache.set_write_ahead_log(&log);
+
+        my_cache.put(1, 10);
+        my_cache.put(2, 20, 1000);
+        EXPECT_EQ(log.get_count(), 2);
+    }
+    {
+        wal_stream<entry<int, int>> log(log_path);
+        int sum = 0;
+        log.replay([&](const entry<int, int> &item) { sum += item.value; });
+        EXPECT_EQ(sum, 30);
+    }
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+}
+
+TEST(cache_test, write_ahead_log_recovers_lost_backing_writes)
+{
+    const std::string path = "cache_wal_recovery_test.bin";
+    const std::string log_path = "cache_wal_recovery_test.log";
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+    {
+        wal_stream<entry<int, int>> log(log_path);
+        cache<int, int> my_cache(4, 100, cache_hash, path);
+        my_cache.set_write_ahead_log(&log);
+
+        my_cache.put(1, 10);
+        my_cache.put(2, 20);
+        my_cache.put(1, 11);
+    }
+    std::filesystem::resize_file(path, sizeof(entry<int, int>) + 3);
+    {
+        wal_stream<entry<int, int>> log(log_path);
+        EXPECT_EQ(log.get_recovered_count(), 3);
+
+        cache<int, int> my_cache(4, 100, cache_hash, path);
+        my_cache.set_write_ahead_log(&log);
+        EXPECT_EQ(log.get_count(), 0);
+        EXPECT_EQ(std::filesystem::file_size(path) % sizeof(entry<int, int>), 0u);
+
+        EXPECT_EQ(my_cache.get(1), 11);
+        EXPECT_EQ(my_cache.get(2), 20);
+
+        my_cache.put(3, 30);
+        EXPECT_EQ(log.get_count(), 1);
+        my_cache.checkpoint();
+        EXPECT_EQ(log.get_count(), 0);
+    }
+    std::remove(path.c_str());
+    std::remove(log_path.c_str());
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "hash_table/cuckoo_table.hpp"
+#include <string>
+
+TEST(cuckoo_table_test, set_and_get)
+{
+    cuckoo_table<int, int> table;
+
+    table.set(1, 10);
+    table.set(2, 20);
+    table.set(1, 11);
+
+    EXPECT_EQ(table.get_count(), 2);
+    EXPECT_EQ(table.get(1), 11);
+    EXPECT_EQ(table.get(2), 20);
+    EXPECT_THROW(table.get(3), std::out_of_range);
+}
+
+TEST(cuckoo_table_test, erase_and_remove)
+{
+    cuckoo_table<int, int> table;
+
+    table.set(1, 10);
+    table.set(2, 20);
+
+    EXPECT_EQ(table.erase(1), 1u);
+    EXPECT_EQ(table.erase(1), 0u);
+    EXPECT_FALSE(table.contains_key(1));
+    EXPECT_TRUE(table.contains_key(2));
+    EXPECT_THROW(table.remove(1), std::out_of_range);
+    EXPECT_EQ(table.get_count(), 1);
+}
+
+TEST(cuckoo_table_test, high_load_factor)
+{
+    cuckoo_table<int, int> table(std::hash<int>(), 1 << 14);
+    const int capacity = table.get_capacity();
+    const int size = static_cast<int>(capacity * 0.93);
+
+    for (int i = 0; i < size; i++)
+    {
+        table.set(i * 31, i);
+    }
+
+    EXPECT_EQ(table.get_capacity(), capacity);
+    EXPECT_GT(table.get_load_factor(), 0.9);
+    for (int i = 0; i < size; i++)
+    {
+        ASSERT_EQ(table.get(i * 31), i);
+    }
+}
+
+TEST(cuckoo_table_test, growth_keeps_entries)
+{
+    cuckoo_table<int, int> table(std::hash<int>(), 8);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        table.set(i, -i);
+    }
+
+    EXPECT_EQ(table.get_count(), 10000);
+    for (int i = 0; i < 10000; i++)
+    {
+        ASSERT_EQ(table.get(i), -i);
+    }
+    EXPECT_FALSE(table.contains_key(10000));
+}
+
+TEST(cuckoo_table_test, string_keys)
+{
+    cuckoo_table<std::string, int> table;
+
+    for (int i = 0; i < 500; i++)
+    {
+        table.set("key" + std::to_string(i), i);
+    }
+
+    EXPECT_EQ(table.get("key42"), 42);
+    EXPECT_FALSE(table.contains_key("key500"));
+}
+
+TEST(cuckoo_table_test, keys_iterator)
+{
+    cuckoo_table<int, int> table;
+    for (int i = 1; i <= 20; i++)
+    {
+        table.set(i, i);
+    }
+
+    auto iterator = table.get_keys_iterator();
+    int sum = 0;
+    int visited = 0;
+    do
+    {
+        sum += iterator->get_current();
+        visited++;
+    } while (iterator->next());
+
+    EXPECT_EQ(visited, 20);
+    EXPECT_EQ(sum, 210);
+    delete iterator;
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "hash_table/fixed_hash_map.hpp"
+#include <set>
+#include <string_view>
+
+constexpr fixed_hash_map<int, int, 8> status_codes{{200, 0}, {301, 1}, {404, 2}, {500, 3}};
+
+static_assert(status_codes.get_count() == 4);
+static_assert(status_codes.get(404) == 2);
+static_assert(status_codes.contains_key(301));
+static_assert(!status_codes.contains_key(302));
+static_assert(status_codes.find(302) == nullptr);
+
+constexpr fixed_hash_map<std::string_view, int, 4> level_names{{"debug", 0}, {"info", 1}, {"warning", 2}, {"error", 3}};
+
+static_assert(level_names.get("warning") == 2);
+
+TEST(fixed_hash_map_test, runtime_lookups)
+{
+    fixed_hash_map<int, int, 64> table;
+    for (int i = 0; i < 64; i++)
+    {
+        table.set(i * 31, i);
+    }
+    table.set(31, 100);
+
+    EXPECT_EQ(table.get_count(), 64);
+    EXPECT_EQ(table.get_capacity(), 64);
+    EXPECT_EQ(table.get(31), 100);
+    EXPECT_EQ(table.get(63 * 31), 63);
+    EXPECT_THROW(table.get(1), std::out_of_range);
+    EXPECT_THROW(table.set(1, 1), std::invalid_argument);
+}
+
+TEST(fixed_hash_map_test, rejects_duplicate_keys)
+{
+    auto build = []() { return fixed_hash_map<int, int, 4>{{1, 1}, {1, 2}}; };
+    EXPECT_THROW(build(), std::invalid_argument);
+}
+
+TEST(fixed_hash_map_test, readonly_dictionary_interface)
+{
+    const i_readonly_dictionary<int, int> &dictionary = status_codes;
+    EXPECT_EQ(dictionary.get(500), 3);
+    EXPECT_TRUE(dictionary.contains_key(200));
+
+    auto iterator = dictionary.get_keys_iterator();
+    std::set<int> keys;
+    do
+    {
+        keys.insert(iterator->get_current());
+    } while (iterator->next());
+
+    EXPECT_EQ(keys, (std::set<int>{200, 301, 404, 500}));
+    delete iterator;
+}
@@ -109,6 +109,42 @@ TEST(hash_table_test, method_set_existing_key)
     EXPECT_EQ(table.get_count(), 1);
 }
 
+TEST(hash_table_test, method_insert_or_assign)
+{
+    hash_table<int, std::string> table(simple_int_hash);
+
+    std::string value = "first";
+    EXPECT_TRUE(table.insert_or_assign(1, std::move(value)));
+    EXPECT_FALSE(table.insert_or_assign(1, "second"));
+
+    EXPECT_EQ(table.get(1), "second");
+    EXPECT_EQ(table.get_count(), 1);
+}
+
+TEST(hash_table_test, method_try_emplace)
+{
+    hash_table<int, std::string> table(simple_int_hash);
+
+    EXPECT_TRUE(table.try_emplace(1, 3, 'a'));
+    EXPECT_FALSE(table.try_emplace(1, 3, 'b'));
+    EXPECT_TRUE(table.try_emplace(2));
+
+    EXPECT_EQ(table.get(1), "aaa");
+    EXPECT_EQ(table.get(2), "");
+    EXPECT_EQ(table.get_count(), 2);
+}
+
+TEST(hash_table_test, method_emplace)
+{
+    hash_table<std::string, std::string> table([](const std::string &key) { return static_cast<int>(key.size()); });
+
+    EXPECT_TRUE(table.emplace("key", "value"));
+    EXPECT_FALSE(table.emplace(std::string("key"), "other"));
+
+    EXPECT_EQ(table.get("key"), "value");
+    EXPECT_EQ(table.get_count(), 1);
+}
+
 TEST(hash_table_test, method_del_existing_key)
 {
     hash_table<int, std::string> table(simple_int_hash);
@@ -170,6 +206,25 @@ TEST(hash_table_test, method_rehash)
     }
 }
 
+TEST(hash_table_test, method_rehash_moves_entries)
+{
+    hash_table<int, int> table([](const int &key)
+                               { return key; }, 4);
+
+    for (int i = 0; i < 40; i += 3)
+    {
+        table.set(i, i);
+    }
+
+    table.rehash(64);
+
+    for (int i = 0; i < 40; i += 3)
+    {
+        EXPECT_EQ(table.get(i), i);
+    }
+    EXPECT_TRUE(table.is_consistent());
+}
+
 TEST(hash_table_test, method_resize)
 {
     hash_table<int, std::string> table(simple_int_hash, 4);
@@ -624,3 +679,121 @@ TEST(hash_table_test, complex_operations_chain)
     EXPECT_TRUE(table.contains_key(4));
     EXPECT_TRUE(table.contains_key(5));
 }
+
+TEST(hash_table_test, reseeds_on_pathological_chains)
+{
+    hash_table<int, int> table([](const int &key) { return key % 4; }, 8);
+
+    for (int i = 0; i < 2000; i++)
+    {
+        table.set(i, i);
+    }
+
+    EXPECT_GE(table.get_reseed_count(), 1);
+    EXPECT_LE(table.get_max_chain_length(), 32);
+    EXPECT_TRUE(table.is_consistent());
+    for (int i = 0; i < 2000; i++)
+    {
+        EXPECT_EQ(table.get(i), i);
+    }
+}
+
+TEST(hash_table_test, chain_limit_can_be_disabled)
+{
+    hash_table<int, int> table([](const int &key) { return key % 4; }, 8);
+    table.set_chain_limit(0);
+
+    for (int i = 0; i < 200; i++)
+    {
+        table.set(i, i);
+    }
+
+    EXPECT_EQ(table.get_reseed_count(), 0);
+    EXPECT_EQ(table.get_max_chain_length(), 50);
+}
+
+TEST(hash_table_test, shrinks_incrementally_after_erase)
+{
+    hash_table<int, int> table([](const int &key) { return key; }, 8);
+    table.set_shrink_policy(0.125);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        table.set(i, i);
+    }
+    int peak = table.get_capacity();
+    size_t peak_bytes = table.memory_usage();
+
+    for (int i = 0; i < 990; i++)
+    {
+        table.erase(i);
+        EXPECT_TRUE(table.contains_key(999));
+    }
+    for (int i = 0; i < 200; i++)
+    {
+        table.set(2000 + i, i);
+        table.erase(2000 + i);
+    }
+
+    EXPECT_LT(table.get_capacity(), peak);
+    EXPECT_LT(table.memory_usage(), peak_bytes);
+    EXPECT_LE(table.get_load_factor(), 0.5);
+    EXPECT_TRUE(table.is_consistent());
+    for (int i = 990; i < 1000; i++)
+    {
+        EXPECT_EQ(table.get(i), i);
+    }
+}
+
+TEST(hash_table_test, shrink_to_fit_releases_buckets)
+{
+    hash_table<int, std::string> table([](const int &key) { return key; }, 8);
+    for (int i = 0; i < 100; i++)
+    {
+        table.set(i, std::string(64, 'x'));
+    }
+    table.filter([](const std::string &) { return false; });
+    table.set(1, "one");
+
+    size_t before = table.memory_usage();
+    table.shrink_to_fit();
+
+    EXPECT_EQ(table.get_capacity(), 4);
+    EXPECT_LT(table.memory_usage(), before);
+    EXPECT_EQ(table.get(1), "one");
+    EXPECT_GE(table.memory_usage(), sizeof(table) + sizeof(entry<int, std::string>));
+    EXPECT_THROW(table.set_shrink_policy(0.6, 0.5), std::invalid_argument);
+}
+
+TEST(hash_table_test, shrink_policy_handles_fitted_and_odd_capacities)
+{
+    hash_table<int, int> fitted([](const int &key) { return key; }, 8);
+    hash_table<int, int> odd([](const int &key) { return key; }, 101);
+    for (int i = 0; i < 41; i++)
+    {
+        fitted.set(i, i);
+        odd.set(i, i);
+    }
+    fitted.shrink_to_fit();
+    EXPECT_EQ(fitted.get_capacity(), 44);
+
+    for (hash_table<int, int> *table : {&fitted, &odd})
+    {
+        int before = table->get_capacity();
+        table->set_shrink_policy(0.125);
+        for (int i = 0; i < 39; i++)
+        {
+            table->erase(i);
+        }
+        for (int i = 0; i < 50; i++)
+        {
+            table->set(1000 + i, i);
+            table->erase(1000 + i);
+        }
+
+        EXPECT_LT(table->get_capacity(), before);
+        EXPECT_TRUE(table->is_consistent());
+        EXPECT_EQ(table->get(39), 39);
+        EXPECT_EQ(table->get(40), 40);
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "aggregation/hash_aggregate.hpp"
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+static void write_aggregate_input(const std::string &path, int records, int distinct_keys)
+{
+    std::remove(path.c_str());
+    file_stream<entry<int, long long>> stream(path);
+    for (int i = 0; i < records; i++)
+    {
+        stream.write(entry<int, long long>((i * 7919) % distinct_keys, 1));
+    }
+    stream.close();
+}
+
+static int count_spill_files(const std::string &prefix)
+{
+    int files = 0;
+    for (const auto &file : std::filesystem::directory_iterator("."))
+    {
+        if (file.path().filename().string().rfind(prefix, 0) == 0)
+        {
+            files++;
+        }
+    }
+    return files;
+}
+
+static long long add_values(const long long &a, const long long &b)
+{
+    return a + b;
+}
+
+TEST(hash_aggregate_test, aggregates_in_memory)
+{
+    const std::string path = "aggregate_memory_test.bin";
+    write_aggregate_input(path, 10000, 100);
+
+    hash_aggregate<int, long long> aggregate([](const int &key) { return key; }, add_values, 1000, 4);
+    auto result = aggregate.run(path);
+
+    EXPECT_EQ(result.get_count(), 100);
+    for (int key = 0; key < 100; key++)
+    {
+        EXPECT_EQ(result.get(key), 100);
+    }
+    EXPECT_EQ(aggregate.get_spill_count(), 0);
+    std::remove(path.c_str());
+}
+
+TEST(hash_aggregate_test, spills_when_budget_exceeded)
+{
+    const std::string path = "aggregate_spill_test.bin";
+    write_aggregate_input(path, 60000, 20000);
+
+    hash_aggregate<int, long long> aggregate([](const int &key) { return key; }, add_values, 1000, 2, "aggregate_spill_test");
+    long long total = 0;
+    int keys = 0;
+    bool all_equal = true;
+    aggregate.run(path, [&](const int &, const long long &value)
+    {
+        total += value;
+        keys++;
+        all_equal = all_equal && value == 3;
+    });
+
+    EXPECT_GT(aggregate.get_spill_count(), 0);
+    EXPECT_EQ(keys, 20000);
+    EXPECT_EQ(total, 60000);
+    EXPECT_TRUE(all_equal);
+
+    EXPECT_EQ(count_spill_files("aggregate_spill_test_"), 0);
+    std::remove(path.c_str());
+}
+
+TEST(hash_aggregate_test, removes_spill_files_when_merge_fails)
+{
+    const std::string path = "aggregate_failure_test.bin";
+    write_aggregate_input(path, 60000, 20000);
+
+    std::atomic<int> merges(0);
+    hash_aggregate<int, long long> aggregate([](const int &key) { return key; }, [&merges](const long long &a, const long long &b)
+    {
+        if (++merges == 5000)
+        {
+            throw std::runtime_error("merge failed");
+        }
+        return a + b;
+    }, 1000, 2, "aggregate_failure_spill");
+
+    EXPECT_THROW(aggregate.run(path, [](const int &, const long long &) {}), std::runtime_error);
+    EXPECT_GT(aggregate.get_spill_count(), 0);
+    EXPECT_EQ(count_spill_files("aggregate_failure_spill_"), 0);
+    std::remove(path.c_str());
+}
+
+TEST(hash_aggregate_test, rejects_empty_budget)
+{
+    EXPECT_THROW((hash_aggregate<int, long long>([](const int &key) { return key; }, add_values, 0)), std::invalid_argument);
+}
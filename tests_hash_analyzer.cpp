@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "hash_table/hash_analyzer.hpp"
+#include "hash_table/hash_mix.hpp"
+
+static array_sequence<int> analyzer_sample(int count)
+{
+    array_sequence<int> keys;
+    for (int i = 0; i < count; i++)
+    {
+        keys.append_element(i * 7);
+    }
+    return keys;
+}
+
+TEST(hash_analyzer_test, reports_chain_statistics)
+{
+    hash_analyzer<int> analyzer(analyzer_sample(1000), 1024);
+
+    hash_report constant = analyzer.analyze([](const int &) { return 42; });
+    EXPECT_EQ(constant.key_count, 1000);
+    EXPECT_EQ(constant.max_chain, 1000);
+    EXPECT_DOUBLE_EQ(constant.mean_chain, 1000.0);
+    EXPECT_DOUBLE_EQ(constant.expected_probes, 500.5);
+    EXPECT_GT(constant.uniformity, 100.0);
+
+    hash_report identity = analyzer.analyze([](const int &key) { return key; });
+    EXPECT_EQ(identity.max_chain, 1);
+    EXPECT_DOUBLE_EQ(identity.expected_probes, 1.0);
+}
+
+TEST(hash_analyzer_test, selects_best_hasher)
+{
+    hash_analyzer<int> analyzer(analyzer_sample(4000), 4096);
+
+    array_sequence<std::function<int(const int &)>> hashers;
+    hashers.append_element([](const int &key) { return key % 1000; });
+    hashers.append_element([](const int &key) { return static_cast<int>(mix64(static_cast<uint64_t>(key)) & 0x7fffffff); });
+    hashers.append_element([](const int &key) { return key & 0xff; });
+
+    array_sequence<hash_report> reports = analyzer.compare(hashers);
+    EXPECT_GE(reports[0].max_chain, 4);
+    EXPECT_LT(reports[1].expected_probes, reports[0].expected_probes);
+    EXPECT_LT(reports[1].uniformity, 2.0);
+    EXPECT_EQ(analyzer.select(hashers), 1);
+}
+
+TEST(hash_analyzer_test, summarizes_table_distribution)
+{
+    array_sequence<int> distribution = {2, 0, 1, 1};
+    hash_report report = hash_analyzer<int>::summarize(distribution);
+    EXPECT_EQ(report.key_count, 4);
+    EXPECT_EQ(report.max_chain, 2);
+    EXPECT_DOUBLE_EQ(report.chi_squared, 2.0);
+    EXPECT_DOUBLE_EQ(report.mean_chain, 4.0 / 3.0);
+    EXPECT_DOUBLE_EQ(report.expected_probes, 1.25);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "aggregation/hash_join.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+static void write_join_inputs(const std::string &build_path, const std::string &probe_path, int build_keys, int probe_records)
+{
+    std::remove(build_path.c_str());
+    std::remove(probe_path.c_str());
+
+    file_stream<entry<int, int>> build(build_path);
+    for (int key = 0; key < build_keys; key++)
+    {
+        build.write(entry<int, int>(key, key * 2));
+    }
+    build.write(entry<int, int>(0, -1));
+    build.close();
+
+    file_stream<entry<int, long long>> probe(probe_path);
+    for (int i = 0; i < probe_records; i++)
+    {
+        probe.write(entry<int, long long>(i % (build_keys * 2), i));
+    }
+    probe.close();
+}
+
+static int count_spill_files(const std::string &prefix)
+{
+    int files = 0;
+    for (const auto &file : std::filesystem::directory_iterator("."))
+    {
+        if (file.path().filename().string().rfind(prefix, 0) == 0)
+        {
+            files++;
+        }
+    }
+    return files;
+}
+
+TEST(hash_join_test, joins_in_memory)
+{
+    write_join_inputs("join_build_test.bin", "join_probe_test.bin", 100, 1000);
+
+    hash_join<int, int, long long> join([](const int &key) { return key; }, 1000, 4);
+    int matches = 0;
+    int duplicates = 0;
+    bool consistent = true;
+    join.run("join_build_test.bin", "join_probe_test.bin", [&](const int &key, const int &left, const long long &right)
+    {
+        matches++;
+        duplicates += left == -1;
+        consistent = consistent && (left == key * 2 || (key == 0 && left == -1)) && right % 200 == key;
+    });
+
+    EXPECT_EQ(join.get_partition_count(), 0);
+    EXPECT_EQ(matches, 505);
+    EXPECT_EQ(duplicates, 5);
+    EXPECT_TRUE(consistent);
+
+    std::remove("join_build_test.bin");
+    std::remove("join_probe_test.bin");
+}
+
+TEST(hash_join_test, partitions_when_build_side_exceeds_budget)
+{
+    write_join_inputs("join_grace_build_test.bin", "join_grace_probe_test.bin", 20000, 100000);
+
+    hash_join<int, int, long long> join([](const int &key) { return key; }, 1000, 4, "join_grace_spill");
+    int matches = 0;
+    bool consistent = true;
+    join.run("join_grace_build_test.bin", "join_grace_probe_test.bin", [&](const int &key, const int &left, const long long &right)
+    {
+        matches++;
+        consistent = consistent && (left == key * 2 || (key == 0 && left == -1)) && right % 40000 == key;
+    });
+
+    EXPECT_GT(join.get_partition_count(), 1);
+    EXPECT_EQ(matches, 60000 + 3);
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(count_spill_files("join_grace_spill_"), 0);
+
+    std::remove("join_grace_build_test.bin");
+    std::remove("join_grace_probe_test.bin");
+}
+
+TEST(hash_join_test, repartitions_oversized_partitions)
+{
+    write_join_inputs("join_deep_build_test.bin", "join_deep_probe_test.bin", 20000, 100000);
+
+    hash_join<int, int, long long> join([](const int &key) { return key; }, 100, 4, "join_deep_spill");
+    int matches = 0;
+    bool consistent = true;
+    join.run("join_deep_build_test.bin", "join_deep_probe_test.bin", [&](const int &key, const int &left, const long long &right)
+    {
+        matches++;
+        consistent = consistent && (left == key * 2 || (key == 0 && left == -1)) && right % 40000 == key;
+    });
+
+    EXPECT_GT(join.get_partition_count(), 64);
+    EXPECT_EQ(matches, 60000 + 3);
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(count_spill_files("join_deep_spill_"), 0);
+
+    std::remove("join_deep_build_test.bin");
+    std::remove("join_deep_probe_test.bin");
+}
+
+TEST(hash_join_test, joins_skewed_key_beyond_budget)
+{
+    std::remove("join_skew_build_test.bin");
+    std::remove("join_skew_probe_test.bin");
+    {
+        file_stream<entry<int, int>> build("join_skew_build_test.bin");
+        for (int i = 0; i < 500; i++)
+        {
+            build.write(entry<int, int>(7, i));
+        }
+        build.write(entry<int, int>(8, -8));
+        build.close();
+
+        file_stream<entry<int, long long>> probe("join_skew_probe_test.bin");
+        probe.write(entry<int, long long>(7, 70));
+        probe.write(entry<int, long long>(8, 80));
+        probe.write(entry<int, long long>(9, 90));
+        probe.close();
+    }
+
+    hash_join<int, int, long long> join([](const int &key) { return key; }, 100, 2, "join_skew_spill");
+    int matches = 0;
+    join.run("join_skew_build_test.bin", "join_skew_probe_test.bin", [&](const int &, const int &, const long long &)
+    {
+        matches++;
+    });
+
+    EXPECT_EQ(matches, 501);
+    EXPECT_EQ(count_spill_files("join_skew_spill_"), 0);
+
+    std::remove("join_skew_build_test.bin");
+    std::remove("join_skew_probe_test.bin");
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "mrc_estimator.hpp"
+#include "cache.hpp"
+#include "benchmark_utils.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+auto mrc_hash = [](const int &key)
+{
+    return key & 0x7fffffff;
+};
+
+TEST(mrc_estimator_test, disabled_by_default)
+{
+    mrc_estimator<int> estimator(mrc_hash);
+    estimator.access(1);
+
+    EXPECT_FALSE(estimator.is_enabled());
+    EXPECT_EQ(estimator.get_reference_count(), 0.0);
+    EXPECT_EQ(estimator.miss_ratio(10), 1.0);
+}
+
+TEST(mrc_estimator_test, exact_loop_curve)
+{
+    mrc_estimator<int> estimator(mrc_hash);
+    estimator.reset(1.0, 1);
+
+    auto workload = generate_loop_workload(100, 10);
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        estimator.access(workload.get(i));
+    }
+
+    EXPECT_DOUBLE_EQ(estimator.miss_ratio(9), 1.0);
+    EXPECT_DOUBLE_EQ(estimator.miss_ratio(10), 0.1);
+    EXPECT_DOUBLE_EQ(estimator.miss_ratio(1000), 0.1);
+}
+
+TEST(mrc_estimator_test, sampled_curve_tracks_exact_curve)
+{
+    mrc_estimator<int> exact(mrc_hash);
+    mrc_estimator<int> sampled(mrc_hash);
+    mrc_estimator<int> bounded(mrc_hash);
+    exact.reset(1.0, 10);
+    sampled.reset(0.1, 10);
+    bounded.reset(0.5, 10, 200);
+
+    auto workload = generate_zipf_workload(200000, 20000, 0.9);
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        exact.access(workload.get(i));
+        sampled.access(workload.get(i));
+        bounded.access(workload.get(i));
+    }
+
+    EXPECT_LT(bounded.get_sampling_rate(), 0.5);
+    for (int capacity = 100; capacity <= 10000; capacity *= 10)
+    {
+        EXPECT_NEAR(sampled.miss_ratio(capacity), exact.miss_ratio(capacity), 0.1);
+        EXPECT_NEAR(bounded.miss_ratio(capacity), exact.miss_ratio(capacity), 0.1);
+    }
+}
+
+TEST(mrc_estimator_test, cache_curve_matches_lru)
+{
+    const std::string path = "mrc_cache_test.bin";
+    std::remove(path.c_str());
+    generate_sequential_database<int, int>(path, 500);
+
+    auto workload = generate_zipf_workload(5000, 500, 1.0);
+    cache<int, int> small_cache(50, 500, mrc_hash, path);
+    small_cache.enable_miss_ratio_curve(1.0);
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        small_cache.get(workload.get(i));
+    }
+
+    array_sequence<int64_t> capacities = {50};
+    auto curve = small_cache.get_miss_ratio_curve(capacities);
+
+    EXPECT_NEAR(curve.get(0), 1.0 - small_cache.get_hit_ratio(), 1e-9);
+    EXPECT_LT(small_cache.estimate_miss_ratio(400), curve.get(0));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "file_stream/partitioned_store.hpp"
+#include "cache.hpp"
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+static array_sequence<std::string> partition_paths(const std::string &prefix, int count)
+{
+    array_sequence<std::string> paths;
+    for (int i = 0; i < count; i++)
+    {
+        paths.append_element(prefix + std::to_string(i) + ".bin");
+        std::remove(paths.get(i).c_str());
+    }
+    return paths;
+}
+
+static void remove_partitions(const array_sequence<std::string> &paths)
+{
+    for (int i = 0; i < paths.get_length(); i++)
+    {
+        std::remove(paths.get(i).c_str());
+    }
+}
+
+TEST(partitioned_store_test, hash_partitioning_routes_records)
+{
+    auto paths = partition_paths("store_hash_test_", 4);
+    {
+        partitioned_store<int, int> store(paths, [](const int &key) { return key; });
+        array_sequence<entry<int, int>> records;
+        for (int i = 0; i < 400; i++)
+        {
+            records.append_element(entry<int, int>(i, i * 3));
+        }
+        store.load(records);
+        store.write(1000, 7);
+
+        EXPECT_EQ(store.get_count(), 401);
+        for (int p = 0; p < 4; p++)
+        {
+            EXPECT_EQ(store.get_count(p), p == 0 ? 101 : 100);
+        }
+
+        int value = 0;
+        ASSERT_TRUE(store.find(123, value));
+        EXPECT_EQ(value, 369);
+        ASSERT_TRUE(store.find(1000, value));
+        EXPECT_EQ(value, 7);
+        EXPECT_FALSE(store.find(401, value));
+    }
+    remove_partitions(paths);
+}
+
+TEST(partitioned_store_test, range_partitioning)
+{
+    auto paths = partition_paths("store_range_test_", 3);
+    {
+        partitioned_store<int, int> store(paths, array_sequence<int>{100, 200});
+        EXPECT_EQ(store.partition_of(-5), 0);
+        EXPECT_EQ(store.partition_of(99), 0);
+        EXPECT_EQ(store.partition_of(100), 1);
+        EXPECT_EQ(store.partition_of(250), 2);
+
+        store.write(150, 1);
+        EXPECT_EQ(store.get_count(1), 1);
+        EXPECT_EQ(store.get_count(0), 0);
+    }
+    remove_partitions(paths);
+
+    EXPECT_THROW((partitioned_store<int, int>(paths, array_sequence<int>{100})), std::invalid_argument);
+    remove_partitions(paths);
+}
+
+TEST(partitioned_store_test, parallel_scan_visits_every_record)
+{
+    auto paths = partition_paths("store_scan_test_", 4);
+    {
+        partitioned_store<int, int> store(paths, [](const int &key) { return key * 7; });
+        array_sequence<entry<int, int>> records;
+        for (int i = 0; i < 5000; i++)
+        {
+            records.append_element(entry<int, int>(i, 1));
+        }
+        store.load(records);
+
+        std::atomic<int> visited(0);
+        std::atomic<int> misplaced(0);
+        store.scan([&](int partition, const entry<int, int> &item)
+        {
+            visited++;
+            if (store.partition_of(item.key) != partition)
+            {
+                misplaced++;
+            }
+        });
+        EXPECT_EQ(visited.load(), 5000);
+        EXPECT_EQ(misplaced.load(), 0);
+    }
+    remove_partitions(paths);
+}
+
+TEST(partitioned_store_test, cache_routes_misses_to_partitions)
+{
+    auto paths = partition_paths("store_cache_test_", 2);
+    const std::string path = "store_cache_test.bin";
+    std::remove(path.c_str());
+    {
+        partitioned_store<int, int> store(paths, [](const int &key) { return key; });
+        for (int i = 0; i < 20; i++)
+        {
+            store.write(i, i + 100);
+        }
+
+        cache<int, int> my_cache(10, 100, [](const int &key) { return key; }, path);
+        my_cache.set_backing_store(&store);
+
+        EXPECT_EQ(my_cache.get(7), 107);
+        EXPECT_EQ(my_cache.get(12), 112);
+        EXPECT_EQ(my_cache.get_miss_count(), 2);
+
+        my_cache.put(30, 5);
+        int value = 0;
+        ASSERT_TRUE(store.find(30, value));
+        EXPECT_EQ(value, 5);
+    }
+    remove_partitions(paths);
+    std::remove(path.c_str());
+}
+
+TEST(partitioned_store_test, cache_reads_latest_overwrite_after_eviction)
+{
+    auto paths = partition_paths("store_overwrite_test_", 2);
+    const std::string path = "store_overwrite_test.bin";
+    std::remove(path.c_str());
+    {
+        partitioned_store<int, int> store(paths, [](const int &key) { return key; });
+        cache<int, int> my_cache(2, 100, [](const int &key) { return key; }, path);
+        my_cache.set_backing_store(&store);
+
+        my_cache.put(1, 10);
+        my_cache.put(1, 11);
+        my_cache.put(2, 20);
+        my_cache.put(3, 30);
+
+        EXPECT_EQ(my_cache.get(1), 11);
+        EXPECT_EQ(my_cache.get_miss_count(), 1);
+    }
+    remove_partitions(paths);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "file_stream/file_stream.hpp"
+#include "file_stream/positional_reader.hpp"
+#include "hash_table/entry.hpp"
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void write_entries(const std::string &path, int count)
+{
+    std::remove(path.c_str());
+    file_stream<entry<int, int>> stream(path);
+    for (int i = 0; i < count; i++)
+    {
+        stream.write(entry<int, int>(i, i * 10));
+    }
+    stream.close();
+}
+
+TEST(positional_reader_test, read_at_index)
+{
+    const std::string path = "positional_read_test.bin";
+    write_entries(path, 100);
+    {
+        positional_reader<entry<int, int>> reader(path);
+        EXPECT_EQ(reader.get_count(), 100);
+
+        entry<int, int> item;
+        ASSERT_TRUE(reader.read_at(42, item));
+        EXPECT_EQ(item.key, 42);
+        EXPECT_EQ(item.value, 420);
+        EXPECT_FALSE(reader.read_at(100, item));
+        EXPECT_THROW(reader.read_at(-1, item), std::out_of_range);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(positional_reader_test, read_range_stops_at_end)
+{
+    const std::string path = "positional_range_test.bin";
+    write_entries(path, 10);
+    {
+        positional_reader<entry<int, int>> reader(path);
+        entry<int, int> items[8];
+        EXPECT_EQ(reader.read_range(6, items, 8), 4);
+        EXPECT_EQ(items[0].key, 6);
+        EXPECT_EQ(items[3].key, 9);
+        EXPECT_EQ(reader.read_range(10, items, 8), 0);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(positional_reader_test, concurrent_reads)
+{
+    const std::string path = "positional_concurrent_test.bin";
+    write_entries(path, 1000);
+    {
+        positional_reader<entry<int, int>> reader(path);
+        std::vector<int> mismatches(4, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&reader, &mismatches, t]()
+            {
+                entry<int, int> item;
+                for (int i = 0; i < 5000; i++)
+                {
+                    int index = (i * 7 + t * 13) % 1000;
+                    if (!reader.read_at(index, item) || item.key != index || item.value != index * 10)
+                    {
+                        mismatches[t]++;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        for (int t = 0; t < 4; t++)
+        {
+            EXPECT_EQ(mismatches[t], 0);
+        }
+    }
+    std::remove(path.c_str());
+}
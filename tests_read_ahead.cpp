@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "read_ahead.hpp"
+
+TEST(read_ahead_test, detects_sequential_misses)
+{
+    read_ahead prefetcher;
+    prefetcher.reset(32, 16);
+
+    int64_t stride = 0;
+    int count = 0;
+    EXPECT_FALSE(prefetcher.on_miss(100, stride, count));
+    EXPECT_FALSE(prefetcher.on_miss(101, stride, count));
+    ASSERT_TRUE(prefetcher.on_miss(102, stride, count));
+    EXPECT_EQ(stride, 1);
+    EXPECT_EQ(count, 4);
+
+    ASSERT_TRUE(prefetcher.on_miss(107, stride, count));
+    EXPECT_EQ(count, 8);
+}
+
+TEST(read_ahead_test, detects_strided_misses_per_stream)
+{
+    read_ahead prefetcher;
+    prefetcher.reset(32, 16);
+
+    int64_t stride = 0;
+    int count = 0;
+    EXPECT_FALSE(prefetcher.on_miss(0, stride, count));
+    EXPECT_FALSE(prefetcher.on_miss(5000, stride, count));
+    EXPECT_FALSE(prefetcher.on_miss(4, stride, count));
+    EXPECT_FALSE(prefetcher.on_miss(4990, stride, count));
+    ASSERT_TRUE(prefetcher.on_miss(8, stride, count));
+    EXPECT_EQ(stride, 4);
+    ASSERT_TRUE(prefetcher.on_miss(4980, stride, count));
+    EXPECT_EQ(stride, -10);
+}
+
+TEST(read_ahead_test, ignores_random_misses)
+{
+    read_ahead prefetcher;
+    prefetcher.reset(32, 16);
+
+    int64_t stride = 0;
+    int count = 0;
+    for (int64_t position = 0; position < 100000; position += 1000)
+    {
+        EXPECT_FALSE(prefetcher.on_miss(position, stride, count));
+    }
+}
+
+TEST(read_ahead_test, backs_off_when_wasted)
+{
+    read_ahead prefetcher;
+    prefetcher.reset(32, 16);
+
+    for (int i = 0; i < 64; i++)
+    {
+        prefetcher.record_wasted();
+    }
+    EXPECT_EQ(prefetcher.get_depth_limit(), 16);
+
+    for (int i = 0; i < 5 * 64; i++)
+    {
+        prefetcher.record_wasted();
+    }
+    EXPECT_EQ(prefetcher.get_depth_limit(), 1);
+
+    for (int i = 0; i < 64; i++)
+    {
+        prefetcher.record_useful();
+    }
+    EXPECT_EQ(prefetcher.get_depth_limit(), 2);
+    EXPECT_EQ(prefetcher.get_wasted_count(), 6 * 64);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "hash_table/separated_table.hpp"
+#include <array>
+#include <string>
+
+struct counted_key
+{
+    int id;
+    static inline int comparisons = 0;
+
+    bool operator==(const counted_key &other) const
+    {
+        comparisons++;
+        return id == other.id;
+    }
+};
+
+TEST(separated_table_test, set_and_get)
+{
+    separated_table<int, int> table;
+
+    table.set(1, 10);
+    table.set(2, 20);
+    table.set(1, 11);
+
+    EXPECT_EQ(table.get_count(), 2);
+    EXPECT_EQ(table.get(1), 11);
+    EXPECT_EQ(table.get(2), 20);
+    EXPECT_THROW(table.get(3), std::out_of_range);
+}
+
+TEST(separated_table_test, erase_keeps_probe_chains)
+{
+    separated_table<int, int> table(std::hash<int>(), 8);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        table.set(i, i * 2);
+    }
+    for (int i = 0; i < 5000; i += 3)
+    {
+        EXPECT_EQ(table.erase(i), 1u);
+    }
+    EXPECT_EQ(table.erase(0), 0u);
+    EXPECT_THROW(table.remove(3), std::out_of_range);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        ASSERT_EQ(table.contains_key(i), i % 3 != 0);
+    }
+    for (int i = 0; i < 5000; i += 3)
+    {
+        table.set(i, -i);
+    }
+    EXPECT_EQ(table.get_count(), 5000);
+    EXPECT_EQ(table.get(2997), -2997);
+}
+
+TEST(separated_table_test, growth_moves_only_index)
+{
+    separated_table<int, std::array<char, 1024>> table(std::hash<int>(), 8);
+    std::array<char, 1024> value{};
+
+    for (int i = 0; i < 2000; i++)
+    {
+        value[0] = static_cast<char>(i);
+        table.set(i, value);
+    }
+
+    EXPECT_EQ(table.get_index_bytes(), table.get_capacity() * sizeof(separated_table<int, std::array<char, 1024>>::index_slot));
+    EXPECT_LE(table.get_load_factor(), 0.75);
+    for (int i = 0; i < 2000; i++)
+    {
+        ASSERT_EQ(table.get(i)[0], static_cast<char>(i));
+    }
+}
+
+TEST(separated_table_test, compares_keys_only_on_fingerprint_match)
+{
+    separated_table<counted_key, int> table([](const counted_key &key) { return std::hash<int>()(key.id); });
+
+    for (int i = 0; i < 1000; i++)
+    {
+        table.set(counted_key{i}, i);
+    }
+
+    counted_key::comparisons = 0;
+    for (int i = 1000; i < 2000; i++)
+    {
+        EXPECT_FALSE(table.contains_key(counted_key{i}));
+    }
+    EXPECT_LE(counted_key::comparisons, 1);
+
+    counted_key::comparisons = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(table.get(counted_key{i}), i);
+    }
+    EXPECT_EQ(counted_key::comparisons, 1000);
+}
+
+TEST(separated_table_test, keys_iterator)
+{
+    separated_table<std::string, int> table;
+    table.set("one", 1);
+    table.set("two", 2);
+    table.set("three", 3);
+
+    int sum = 0;
+    i_iterator<std::string> *iterator = table.get_keys_iterator();
+    do
+    {
+        sum += table.get(iterator->get_current());
+    } while (iterator->next());
+    delete iterator;
+
+    EXPECT_EQ(sum, 6);
+}
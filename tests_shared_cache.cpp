@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "file_stream/file_stream.hpp"
+#include "shared_cache.hpp"
+#include <cstdio>
+#include <string>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+static int shared_hash(const int &key)
+{
+    return key;
+}
+
+static void write_shared_entries(const std::string &path, int count)
+{
+    std::remove(path.c_str());
+    file_stream<entry<int, int>> stream(path);
+    for (int i = 0; i < count; i++)
+    {
+        stream.write(entry<int, int>(i, i * 10));
+    }
+    stream.close();
+}
+
+#if defined(__linux__)
+
+TEST(shared_cache_test, loads_from_backing_store)
+{
+    const std::string path = "shared_cache_load_test.bin";
+    const std::string name = "/shared_cache_load_" + std::to_string(getpid());
+    write_shared_entries(path, 100);
+    {
+        shared_cache<int, int> cache(name, 16, shared_hash, path);
+        EXPECT_EQ(cache.get(42), 420);
+        EXPECT_EQ(cache.get(42), 420);
+        EXPECT_EQ(cache.get_hit_count(), 1);
+        EXPECT_EQ(cache.get_miss_count(), 1);
+        EXPECT_THROW(cache.get(1000), std::out_of_range);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, instances_share_segment)
+{
+    const std::string path = "shared_cache_share_test.bin";
+    const std::string name = "/shared_cache_share_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    {
+        shared_cache<int, int> first(name, 16, shared_hash, path);
+        shared_cache<int, int> second(name, 16, shared_hash, path);
+
+        first.put(7, 77);
+        int value = 0;
+        ASSERT_TRUE(second.try_get(7, value));
+        EXPECT_EQ(value, 77);
+        EXPECT_EQ(second.get_size(), 1);
+
+        second.clear();
+        EXPECT_FALSE(first.try_get(7, value));
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, visible_across_processes)
+{
+    const std::string path = "shared_cache_process_test.bin";
+    const std::string name = "/shared_cache_process_" + std::to_string(getpid());
+    write_shared_entries(path, 100);
+    {
+        shared_cache<int, int> cache(name, 64, shared_hash, path);
+
+        pid_t child = fork();
+        ASSERT_NE(child, -1);
+        if (child == 0)
+        {
+            shared_cache<int, int> other(name, 64, shared_hash, path);
+            for (int i = 0; i < 10; i++)
+            {
+                other.get(i);
+            }
+            _exit(0);
+        }
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status));
+
+        EXPECT_EQ(cache.get_size(), 10);
+        int value = 0;
+        ASSERT_TRUE(cache.try_get(5, value));
+        EXPECT_EQ(value, 50);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, evicts_least_recently_used)
+{
+    const std::string path = "shared_cache_evict_test.bin";
+    const std::string name = "/shared_cache_evict_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    {
+        shared_cache<int, int> cache(name, 3, shared_hash, path);
+        cache.put(1, 1);
+        cache.put(2, 2);
+        cache.put(3, 3);
+
+        int value = 0;
+        ASSERT_TRUE(cache.try_get(1, value));
+        cache.put(4, 4);
+
+        EXPECT_EQ(cache.get_size(), 3);
+        EXPECT_FALSE(cache.try_get(2, value));
+        EXPECT_TRUE(cache.try_get(1, value));
+        EXPECT_TRUE(cache.try_get(3, value));
+        EXPECT_TRUE(cache.try_get(4, value));
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, rejects_layout_mismatch)
+{
+    const std::string path = "shared_cache_layout_test.bin";
+    const std::string name = "/shared_cache_layout_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    {
+        shared_cache<int, int> cache(name, 16, shared_hash, path);
+        EXPECT_THROW((shared_cache<int, int>(name, 32, shared_hash, path)), std::runtime_error);
+        EXPECT_THROW((shared_cache<int, long long>(name, 16, shared_hash, path)), std::runtime_error);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+
+TEST(shared_cache_test, loads_latest_backing_record)
+{
+    const std::string path = "shared_cache_latest_test.bin";
+    const std::string name = "/shared_cache_latest_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    {
+        file_stream<entry<int, int>> stream(path);
+        stream.move_position(10);
+        stream.write(entry<int, int>(5, 999));
+        stream.close();
+    }
+    {
+        shared_cache<int, int> cache(name, 4, shared_hash, path);
+        EXPECT_EQ(cache.get(5), 999);
+        EXPECT_EQ(cache.get(6), 60);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, recovers_from_owner_death)
+{
+    const std::string path = "shared_cache_owner_test.bin";
+    const std::string name = "/shared_cache_owner_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    {
+        shared_cache<int, int> cache(name, 8, shared_hash, path);
+        cache.put(1, 100);
+
+        pid_t child = fork();
+        ASSERT_NE(child, -1);
+        if (child == 0)
+        {
+            shared_cache<int, int> dying(name, 8, [](const int &key)
+            {
+                if (key == 666)
+                {
+                    _exit(0);
+                }
+                return key;
+            }, path);
+            dying.put(666, 1);
+            _exit(1);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), 0);
+
+        cache.put(2, 200);
+        EXPECT_EQ(cache.get_recovery_count(), 1);
+        EXPECT_EQ(cache.get(2), 200);
+        EXPECT_EQ(cache.get(3), 30);
+        EXPECT_EQ(cache.get_size(), 2);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+TEST(shared_cache_test, initializes_abandoned_segment)
+{
+    const std::string path = "shared_cache_abandoned_test.bin";
+    const std::string name = "/shared_cache_abandoned_" + std::to_string(getpid());
+    write_shared_entries(path, 10);
+    int descriptor = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    ASSERT_NE(descriptor, -1);
+    ASSERT_EQ(ftruncate(descriptor, 4096), 0);
+    close(descriptor);
+    {
+        shared_cache<int, int> cache(name, 8, shared_hash, path);
+        EXPECT_EQ(cache.get(4), 40);
+        EXPECT_EQ(cache.get_size(), 1);
+    }
+    shared_cache<int, int>::remove(name);
+    std::remove(path.c_str());
+}
+
+#endif
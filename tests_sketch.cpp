@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "sketch/hyperloglog.hpp"
+#include "sketch/count_min_sketch.hpp"
+#include "sketch/space_saving.hpp"
+#include "sketch/sketch_scan.hpp"
+#include "file_stream/file_stream.hpp"
+#include "hash_table/hash.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+static int sketch_hash(const int &key)
+{
+    return key;
+}
+
+TEST(sketch_test, hyperloglog_estimates_and_merges)
+{
+    hyperloglog<int> first(sketch_hash);
+    hyperloglog<int> second(sketch_hash);
+    for (int i = 0; i < 100000; i++)
+    {
+        first.add(i);
+        first.add(i);
+        second.add(i + 50000);
+    }
+
+    EXPECT_NEAR(first.estimate(), 100000.0, 3000.0);
+    first.merge(second);
+    EXPECT_NEAR(first.estimate(), 150000.0, 4500.0);
+
+    hyperloglog<int> small(sketch_hash);
+    for (int i = 0; i < 100; i++)
+    {
+        small.add(i);
+    }
+    EXPECT_NEAR(small.estimate(), 100.0, 3.0);
+
+    hyperloglog<int> other_precision(sketch_hash, 10);
+    EXPECT_THROW(first.merge(other_precision), std::invalid_argument);
+}
+
+TEST(sketch_test, count_min_never_underestimates)
+{
+    count_min_sketch<int> sketch(sketch_hash, 512, 4);
+    count_min_sketch<int> other(sketch_hash, 512, 4);
+    for (int i = 0; i < 5000; i++)
+    {
+        sketch.add(i % 1000);
+        other.add(7);
+    }
+    sketch.add(7, 100);
+
+    for (int key = 0; key < 1000; key++)
+    {
+        EXPECT_GE(sketch.estimate(key), 5u);
+    }
+    EXPECT_GE(sketch.estimate(7), 105u);
+    EXPECT_LT(sketch.estimate(7), 150u);
+
+    sketch.merge(other);
+    EXPECT_GE(sketch.estimate(7), 5105u);
+    EXPECT_EQ(sketch.get_total(), 10100);
+
+    sketch.halve();
+    EXPECT_EQ(sketch.get_total(), 5050);
+}
+
+TEST(sketch_test, space_saving_finds_heavy_hitters)
+{
+    space_saving<int> first(sketch_hash, 16);
+    space_saving<int> second(sketch_hash, 16);
+    for (int i = 0; i < 20000; i++)
+    {
+        first.add(i % 5 == 0 ? 1 : 100 + i % 997);
+        second.add(i % 4 == 0 ? 2 : 2000 + i % 991);
+    }
+
+    auto top = first.top(1);
+    ASSERT_EQ(top.get_length(), 1);
+    EXPECT_EQ(top[0].key, 1);
+    EXPECT_GT(first.guaranteed(1), 0);
+    EXPECT_GE(first.estimate(1), 4000);
+
+    first.merge(second);
+    auto merged = first.top(2);
+    ASSERT_EQ(merged.get_length(), 2);
+    EXPECT_EQ(merged[0].key, 2);
+    EXPECT_EQ(merged[1].key, 1);
+    EXPECT_LE(first.get_count(), 16);
+}
+
+TEST(sketch_test, space_saving_bounds_match_exact_counts)
+{
+    space_saving<int> summary(sketch_hash, 32);
+    hash_table<int, int64_t> exact(sketch_hash);
+    uint32_t state = 12345;
+    for (int i = 0; i < 50000; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        int key = static_cast<int>((state >> 8) % 64) * static_cast<int>((state >> 20) % 4);
+        int64_t count = 1 + (state >> 28) % 3;
+        summary.add(key, count);
+        exact.set(key, (exact.contains_key(key) ? exact.get(key) : 0) + count);
+    }
+
+    auto all = summary.top(32);
+    int64_t floor = all[all.get_length() - 1].count;
+    for (int key = 0; key < 256; key++)
+    {
+        int64_t truth = exact.contains_key(key) ? exact.get(key) : 0;
+        EXPECT_GE(summary.estimate(key), truth);
+        EXPECT_LE(summary.guaranteed(key), truth);
+        if (!summary.contains_key(key))
+        {
+            EXPECT_EQ(summary.estimate(key), floor);
+        }
+    }
+}
+
+TEST(sketch_test, file_scan_presizes_table)
+{
+    const std::string path = "sketch_scan_test.bin";
+    std::remove(path.c_str());
+    {
+        file_stream<entry<int, int>> stream(path);
+        for (int i = 0; i < 60000; i++)
+        {
+            stream.write(entry<int, int>(i % 20000, i));
+        }
+    }
+
+    auto distinct = sketch_file<int, int, hyperloglog<int>>(path, []() { return hyperloglog<int>(sketch_hash); }, 4);
+    int expected = static_cast<int>(std::ceil(distinct.estimate() * 1.05));
+    EXPECT_NEAR(distinct.estimate(), 20000.0, 600.0);
+
+    hash_table<int, int> table(sketch_hash);
+    table.reserve(expected);
+    int capacity = table.get_capacity();
+    for (int i = 0; i < 20000; i++)
+    {
+        table.set(i, i);
+    }
+    EXPECT_EQ(table.get_capacity(), capacity);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "file_stream/slab_cache.hpp"
+#include <cstdio>
+#include <string>
+
+static int slab_hash(const int &key)
+{
+    return key;
+}
+
+TEST(slab_cache_test, store_and_find)
+{
+    const std::string path = "slab_store_test.bin";
+    {
+        slab_cache<int, int> slab(path, 8, slab_hash);
+        slab.store(1, 10);
+        slab.store(2, 20);
+        slab.store(1, 11);
+
+        int value = 0;
+        ASSERT_TRUE(slab.find(1, value));
+        EXPECT_EQ(value, 11);
+        EXPECT_FALSE(slab.find(3, value));
+        EXPECT_EQ(slab.get_count(), 2);
+        EXPECT_EQ(slab.get_hit_count(), 1);
+        EXPECT_EQ(slab.get_miss_count(), 1);
+
+        slab.erase(1);
+        EXPECT_FALSE(slab.find(1, value));
+        EXPECT_EQ(slab.get_count(), 1);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(slab_cache_test, fifo_evicts_oldest)
+{
+    const std::string path = "slab_fifo_test.bin";
+    {
+        slab_cache<int, int> slab(path, 3, slab_hash, slab_policy::fifo);
+        slab.store(1, 10);
+        slab.store(2, 20);
+        slab.store(3, 30);
+
+        int value = 0;
+        ASSERT_TRUE(slab.find(1, value));
+        slab.store(4, 40);
+
+        EXPECT_EQ(slab.get_eviction_count(), 1);
+        EXPECT_FALSE(slab.find(1, value));
+        ASSERT_TRUE(slab.find(4, value));
+        EXPECT_EQ(value, 40);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(slab_cache_test, clock_keeps_referenced_slot)
+{
+    const std::string path = "slab_clock_test.bin";
+    {
+        slab_cache<int, int> slab(path, 3, slab_hash, slab_policy::clock);
+        slab.store(1, 10);
+        slab.store(2, 20);
+        slab.store(3, 30);
+
+        int value = 0;
+        ASSERT_TRUE(slab.find(1, value));
+        slab.store(4, 40);
+
+        EXPECT_TRUE(slab.find(1, value));
+        EXPECT_EQ(value, 10);
+        EXPECT_FALSE(slab.find(2, value));
+        EXPECT_TRUE(slab.find(3, value));
+        EXPECT_TRUE(slab.find(4, value));
+        EXPECT_EQ(slab.get_count(), 3);
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "hash_table/static_dictionary.hpp"
+#include <string>
+
+TEST(static_dictionary_test, get_existing_keys)
+{
+    array_sequence<entry<int, std::string>> entries;
+    entries.append_element(entry<int, std::string>(1, "one"));
+    entries.append_element(entry<int, std::string>(2, "two"));
+    entries.append_element(entry<int, std::string>(3, "three"));
+
+    static_dictionary<int, std::string> dict(entries);
+
+    EXPECT_EQ(dict.get_count(), 3);
+    EXPECT_EQ(dict.get_capacity(), 3);
+    EXPECT_EQ(dict.get(1), "one");
+    EXPECT_EQ(dict.get(2), "two");
+    EXPECT_EQ(dict.get(3), "three");
+}
+
+TEST(static_dictionary_test, missing_key)
+{
+    array_sequence<entry<int, int>> entries;
+    entries.append_element(entry<int, int>(10, 100));
+
+    static_dictionary<int, int> dict(entries);
+
+    EXPECT_TRUE(dict.contains_key(10));
+    EXPECT_FALSE(dict.contains_key(11));
+    EXPECT_THROW(dict.get(11), std::out_of_range);
+}
+
+TEST(static_dictionary_test, empty_dictionary)
+{
+    array_sequence<entry<int, int>> entries;
+
+    static_dictionary<int, int> dict(entries);
+
+    EXPECT_EQ(dict.get_count(), 0);
+    EXPECT_FALSE(dict.contains_key(0));
+}
+
+TEST(static_dictionary_test, duplicate_key)
+{
+    array_sequence<entry<int, int>> entries;
+    entries.append_element(entry<int, int>(5, 1));
+    entries.append_element(entry<int, int>(5, 2));
+
+    EXPECT_THROW((static_dictionary<int, int>(entries)), std::invalid_argument);
+}
+
+TEST(static_dictionary_test, colliding_hash_function)
+{
+    array_sequence<entry<int, int>> entries;
+    entries.append_element(entry<int, int>(1, 1));
+    entries.append_element(entry<int, int>(1001, 2));
+
+    auto bad_hash = [](const int &key) { return static_cast<size_t>(key % 1000); };
+
+    EXPECT_THROW((static_dictionary<int, int>(entries, bad_hash)), std::invalid_argument);
+}
+
+TEST(static_dictionary_test, large_parallel_build)
+{
+    const int size = 300000;
+    array_sequence<entry<int, int>> entries;
+    for (int i = 0; i < size; i++)
+    {
+        entries.append_element(entry<int, int>(i * 7, i));
+    }
+
+    static_dictionary<int, int> dict(entries, std::hash<int>(), 4);
+
+    EXPECT_EQ(dict.get_count(), size);
+    for (int i = 0; i < size; i++)
+    {
+        ASSERT_EQ(dict.get(i * 7), i);
+    }
+    EXPECT_FALSE(dict.contains_key(1));
+    EXPECT_LT(dict.memory_usage(), static_cast<size_t>(size) * (sizeof(entry<int, int>) + 2));
+}
+
+TEST(static_dictionary_test, keys_iterator)
+{
+    array_sequence<entry<int, int>> entries;
+    for (int i = 0; i < 10; i++)
+    {
+        entries.append_element(entry<int, int>(i, i));
+    }
+
+    static_dictionary<int, int> dict(entries);
+    auto iterator = dict.get_keys_iterator();
+
+    int sum = 0;
+    int visited = 0;
+    do
+    {
+        sum += iterator->get_current();
+        visited++;
+    } while (iterator->next());
+
+    EXPECT_EQ(visited, 10);
+    EXPECT_EQ(sum, 45);
+    delete iterator;
+}
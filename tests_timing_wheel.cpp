@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "timing_wheel.hpp"
+
+auto wheel_hash = [](const int &key)
+{
+    return key & 0x7fffffff;
+};
+
+TEST(timing_wheel_test, expires_after_deadline)
+{
+    timing_wheel<int> wheel(wheel_hash, 0);
+    wheel.schedule(1, 10);
+    wheel.schedule(2, 100);
+
+    array_sequence<int> expired;
+    auto collect = [&](const int &key) { expired.append_element(key); };
+
+    wheel.advance(9);
+    EXPECT_EQ(wheel.expire(16, collect), 0);
+    EXPECT_FALSE(wheel.is_expired(1, 9));
+
+    wheel.advance(10);
+    EXPECT_EQ(wheel.expire(16, collect), 1);
+    EXPECT_EQ(expired.get(0), 1);
+    EXPECT_EQ(wheel.get_count(), 1);
+
+    wheel.advance(1000);
+    EXPECT_EQ(wheel.expire(16, collect), 1);
+    EXPECT_EQ(expired.get(1), 2);
+    EXPECT_EQ(wheel.get_count(), 0);
+}
+
+TEST(timing_wheel_test, cancel_and_reschedule)
+{
+    timing_wheel<int> wheel(wheel_hash, 0);
+    wheel.schedule(1, 50);
+    wheel.schedule(2, 50);
+    wheel.cancel(1);
+    wheel.schedule(2, 5000);
+
+    int expired = 0;
+    wheel.advance(100);
+    wheel.expire(16, [&](const int &) { expired++; });
+
+    EXPECT_EQ(expired, 0);
+    EXPECT_TRUE(wheel.contains_key(2));
+    EXPECT_FALSE(wheel.contains_key(1));
+}
+
+TEST(timing_wheel_test, cascades_across_levels)
+{
+    timing_wheel<int> wheel(wheel_hash, 0);
+    for (int i = 1; i <= 200; i++)
+    {
+        wheel.schedule(i, static_cast<int64_t>(i) * 997);
+    }
+    wheel.schedule(1000, int64_t(1) << 30);
+
+    int64_t last_time = -1;
+    int expired = 0;
+    for (int64_t t = 0; t <= 200 * 997; t += 333)
+    {
+        wheel.advance(t);
+        wheel.expire(1000, [&](const int &key)
+        {
+            EXPECT_LE(static_cast<int64_t>(key) * 997, t);
+            EXPECT_GT(static_cast<int64_t>(key) * 997, last_time);
+            expired++;
+        });
+        last_time = t;
+    }
+    wheel.advance(200 * 997);
+    wheel.expire(1000, [&](const int &) { expired++; });
+
+    EXPECT_EQ(expired, 200);
+    EXPECT_EQ(wheel.get_count(), 1);
+
+    wheel.advance(int64_t(1) << 30);
+    EXPECT_EQ(wheel.expire(16, [](const int &) {}), 1);
+}
+
+TEST(timing_wheel_test, expire_respects_budget)
+{
+    timing_wheel<int> wheel(wheel_hash, 0);
+    for (int i = 0; i < 10; i++)
+    {
+        wheel.schedule(i, 1);
+    }
+
+    wheel.advance(1);
+    EXPECT_EQ(wheel.expire(4, [](const int &) {}), 4);
+    EXPECT_EQ(wheel.get_count(), 6);
+}
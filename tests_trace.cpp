@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "trace/trace_replay.hpp"
+#include "cache.hpp"
+#include "benchmark_utils.hpp"
+#include <array>
+#include <cstdio>
+#include <string>
+
+TEST(trace_test, write_and_read_records)
+{
+    const std::string path = "trace_roundtrip_test.bin";
+    {
+        trace_writer<int, int> writer(path);
+        writer.record_get(5);
+        writer.record_put(7, 70);
+        writer.record_get(9);
+        EXPECT_EQ(writer.get_record_count(), 3);
+    }
+
+    trace_reader<int, int> reader(path);
+    trace_record<int, int> record;
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.op, trace_op::get);
+    EXPECT_EQ(record.key, 5);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.op, trace_op::put);
+    EXPECT_EQ(record.key, 7);
+    EXPECT_EQ(record.value, 70);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.key, 9);
+    EXPECT_FALSE(reader.next(record));
+
+    std::remove(path.c_str());
+}
+
+TEST(trace_test, reader_rejects_mismatched_layout)
+{
+    const std::string path = "trace_layout_test.bin";
+    {
+        trace_writer<int, int> writer(path);
+        writer.record_get(1);
+    }
+
+    EXPECT_THROW((trace_reader<long long, int>(path)), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(trace_test, records_values_larger_than_255_bytes)
+{
+    const std::string path = "trace_large_value_test.bin";
+    std::array<char, 300> value{};
+    value[0] = 'a';
+    value[299] = 'z';
+    {
+        trace_writer<int, std::array<char, 300>> writer(path);
+        writer.record_put(3, value);
+    }
+
+    trace_reader<int, std::array<char, 300>> reader(path);
+    trace_record<int, std::array<char, 300>> record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.key, 3);
+    EXPECT_EQ(record.value, value);
+    EXPECT_THROW((trace_reader<int, std::array<char, 44>>(path)), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(trace_test, record_and_replay_cache)
+{
+    const std::string db_path = "trace_replay_db.bin";
+    const std::string trace_path = "trace_replay_test.bin";
+    std::remove(db_path.c_str());
+    generate_sequential_database<int, int>(db_path, 100);
+
+    auto identity = [](const int &key) { return key; };
+    {
+        trace_writer<int, int> writer(trace_path);
+        cache<int, int> my_cache(10, 100, identity, db_path);
+        my_cache.set_trace(&writer);
+
+        for (int i = 0; i < 50; i++)
+        {
+            my_cache.get(i % 20);
+        }
+        EXPECT_EQ(writer.get_record_count(), 50);
+    }
+
+    array_sequence<int> sizes = {5, 20};
+    auto results = replay_trace_sizes<int, int, cache<int, int>>(trace_path, sizes, [&](int size)
+    {
+        return new cache<int, int>(size, 100, identity, db_path);
+    });
+
+    ASSERT_EQ(results.get_length(), 2);
+    EXPECT_EQ(results.get(0).requests, 50);
+    EXPECT_EQ(results.get(1).capacity, 20);
+    EXPECT_LT(results.get(0).hit_ratio, results.get(1).hit_ratio);
+    EXPECT_LE(results.get(1).p50_us, results.get(1).p99_us);
+
+    std::remove(trace_path.c_str());
+    std::remove(db_path.c_str());
+}
+
+TEST(trace_test, zipf_workload_is_skewed)
+{
+    auto workload = generate_zipf_workload(10000, 1000, 1.2);
+
+    int top_ten = 0;
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        ASSERT_GE(workload.get(i), 0);
+        ASSERT_LT(workload.get(i), 1000);
+        if (workload.get(i) < 10)
+        {
+            top_ten++;
+        }
+    }
+    EXPECT_GT(top_ten, 5000);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "file_stream/wal_stream.hpp"
+#include "hash_table/entry.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+
+TEST(wal_stream_test, write_and_replay)
+{
+    const std::string path = "wal_replay_test.log";
+    std::remove(path.c_str());
+    {
+        wal_stream<entry<int, int>> log(path);
+        for (int i = 0; i < 1000; i++)
+        {
+            log.write(entry<int, int>(i, i * 10));
+        }
+        EXPECT_EQ(log.get_count(), 1000);
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 1000);
+        EXPECT_EQ(log.get_truncated_bytes(), 0);
+
+        int next = 0;
+        EXPECT_EQ(log.replay([&](const entry<int, int> &item)
+        {
+            EXPECT_EQ(item.key, next);
+            EXPECT_EQ(item.value, next * 10);
+            next++;
+        }), 1000);
+
+        log.write(entry<int, int>(1000, 0));
+        EXPECT_EQ(log.get_count(), 1001);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(wal_stream_test, recovery_truncates_torn_tail)
+{
+    const std::string path = "wal_torn_test.log";
+    std::remove(path.c_str());
+    {
+        wal_stream<entry<int, int>> log(path);
+        for (int i = 0; i < 10; i++)
+        {
+            log.write(entry<int, int>(i, i));
+        }
+    }
+    {
+        std::ofstream tail(path, std::ios::binary | std::ios::app);
+        tail.write("torn", 4);
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 10);
+        EXPECT_EQ(log.get_truncated_bytes(), 4);
+        log.write(entry<int, int>(10, 10));
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 11);
+        EXPECT_EQ(log.get_truncated_bytes(), 0);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(wal_stream_test, recovery_stops_at_corrupted_frame)
+{
+    const std::string path = "wal_corrupt_test.log";
+    std::remove(path.c_str());
+    long long frame = 0;
+    {
+        wal_stream<entry<int, int>> log(path);
+        log.write(entry<int, int>(1, 1));
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            frame = file.tellg();
+        }
+        log.write(entry<int, int>(2, 2));
+        log.write(entry<int, int>(3, 3));
+    }
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(frame + frame - 1);
+        file.put('\x7f');
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 1);
+        EXPECT_EQ(log.get_truncated_bytes(), 2 * frame);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(wal_stream_test, checkpoint_drops_applied_frames)
+{
+    const std::string path = "wal_checkpoint_test.log";
+    std::remove(path.c_str());
+    {
+        wal_stream<entry<int, int>> log(path);
+        for (int i = 1; i <= 10; i++)
+        {
+            log.write(entry<int, int>(i, i));
+        }
+        log.checkpoint(6);
+        EXPECT_EQ(log.get_count(), 4);
+        log.write(entry<int, int>(11, 11));
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 5);
+        EXPECT_EQ(log.get_truncated_bytes(), 0);
+
+        int next = 7;
+        log.replay([&](const entry<int, int> &item) { EXPECT_EQ(item.key, next++); });
+        EXPECT_EQ(next, 12);
+
+        log.checkpoint(log.get_last_sequence());
+        EXPECT_EQ(log.get_count(), 0);
+        log.write(entry<int, int>(12, 12));
+    }
+    {
+        wal_stream<entry<int, int>> log(path);
+        EXPECT_EQ(log.get_recovered_count(), 1);
+        EXPECT_THROW(log.checkpoint(log.get_last_sequence() + 1), std::invalid_argument);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(wal_stream_test, concurrent_writers_share_commits)
+{
+    const std::string path = "wal_group_test.log";
+    std::remove(path.c_str());
+    {
+        wal_stream<entry<int, int>> log(path, 200);
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 8; t++)
+        {
+            writers.emplace_back([&log, t]()
+            {
+                for (int i = 0; i < 50; i++)
+                {
+                    log.write(entry<int, int>(t * 1000 + i, i));
+                }
+            });
+        }
+        for (auto &writer : writers)
+        {
+            writer.join();
+        }
+
+        EXPECT_EQ(log.get_count(), 400);
+        EXPECT_LT(log.get_commit_count(), 400);
+        EXPECT_EQ(log.replay([](const entry<int, int> &) {}), 400);
+    }
+    std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "hash_table/hash.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+inline int64_t steady_clock_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename t_key>
+class timing_wheel
+{
+private:
+    static constexpr int levels = 4;
+    static constexpr int slot_bits = 6;
+    static constexpr int slots = 1 << slot_bits;
+    static constexpr int due_list = levels * slots;
+    static constexpr int overflow_list = due_list + 1;
+    static constexpr int list_count = overflow_list + 1;
+
+    struct wheel_node
+    {
+        t_key key;
+        int64_t deadline;
+        int prev;
+        int next;
+        int list;
+    };
+
+    array_sequence<wheel_node> nodes;
+    array_sequence<int> heads;
+    hash_table<t_key, int> index;
+    uint64_t occupied[levels];
+    int free_node;
+    int count;
+    int64_t now;
+
+public:
+    timing_wheel(const std::function<int(const t_key &)> &hash_function, int64_t start_time);
+    ~timing_wheel() = default;
+
+    int get_count() const;
+    int64_t get_time() const;
+
+    void schedule(const t_key &key, int64_t deadline);
+    void cancel(const t_key &key);
+    void advance(int64_t time);
+    void reset(int64_t start_time);
+
+    bool contains_key(const t_key &key) const;
+    bool is_expired(const t_key &key, int64_t time) const;
+
+    template <typename t_func>
+    int expire(int budget, t_func on_expired);
+
+private:
+    int64_t next_event() const;
+    int list_for(int64_t deadline) const;
+
+    void place(int node);
+    void link(int node, int list);
+    void unlink(int node);
+    void release(int node);
+    void cascade(int list);
+};
+
+#include "timing_wheel.tpp"
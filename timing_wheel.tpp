@@ -0,0 +1,267 @@
+#include "timing_wheel.hpp"
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+template <typename t_key>
+timing_wheel<t_key>::timing_wheel(const std::function<int(const t_key &)> &hash_function, int64_t start_time)
+    : heads(list_count), index(hash_function), free_node(-1), count(0), now(start_time)
+{
+    for (int i = 0; i < list_count; i++)
+    {
+        heads[i] = -1;
+    }
+    for (int l = 0; l < levels; l++)
+    {
+        occupied[l] = 0;
+    }
+}
+
+template <typename t_key>
+int timing_wheel<t_key>::get_count() const
+{
+    return count;
+}
+
+template <typename t_key>
+int64_t timing_wheel<t_key>::get_time() const
+{
+    return now;
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::schedule(const t_key &key, int64_t deadline)
+{
+    int node;
+    if (index.contains_key(key))
+    {
+        node = index.get(key);
+        unlink(node);
+    }
+    else if (free_node != -1)
+    {
+        node = free_node;
+        free_node = nodes[node].next;
+        index.set(key, node);
+        count++;
+    }
+    else
+    {
+        nodes.append_element(wheel_node{key, deadline, -1, -1, -1});
+        node = nodes.get_length() - 1;
+        index.set(key, node);
+        count++;
+    }
+
+    nodes[node].key = key;
+    nodes[node].deadline = deadline;
+    place(node);
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::cancel(const t_key &key)
+{
+    if (index.contains_key(key))
+    {
+        release(index.get(key));
+    }
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::advance(int64_t time)
+{
+    const int64_t span_mask = (int64_t(1) << (slot_bits * levels)) - 1;
+
+    while (now < time)
+    {
+        int64_t event = next_event();
+        if (event > time)
+        {
+            now = time;
+            break;
+        }
+
+        now = event;
+        if ((now & span_mask) == 0)
+        {
+            cascade(overflow_list);
+        }
+        for (int l = levels - 1; l > 0; l--)
+        {
+            if ((now & ((int64_t(1) << (slot_bits * l)) - 1)) == 0)
+            {
+                cascade(l * slots + static_cast<int>((now >> (slot_bits * l)) & (slots - 1)));
+            }
+        }
+        cascade(static_cast<int>(now & (slots - 1)));
+    }
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::reset(int64_t start_time)
+{
+    if (count != 0)
+    {
+        throw std::logic_error("Cannot reset timing wheel with scheduled keys");
+    }
+
+    nodes.clear();
+    free_node = -1;
+    now = start_time;
+}
+
+template <typename t_key>
+bool timing_wheel<t_key>::contains_key(const t_key &key) const
+{
+    return index.contains_key(key);
+}
+
+template <typename t_key>
+bool timing_wheel<t_key>::is_expired(const t_key &key, int64_t time) const
+{
+    if (!index.contains_key(key))
+    {
+        return false;
+    }
+    return nodes[index.get(key)].deadline <= time;
+}
+
+template <typename t_key>
+template <typename t_func>
+int timing_wheel<t_key>::expire(int budget, t_func on_expired)
+{
+    int expired = 0;
+    while (expired < budget && heads[due_list] != -1)
+    {
+        int node = heads[due_list];
+        t_key key = nodes[node].key;
+        release(node);
+        on_expired(key);
+        expired++;
+    }
+    return expired;
+}
+
+template <typename t_key>
+int64_t timing_wheel<t_key>::next_event() const
+{
+    int64_t event = std::numeric_limits<int64_t>::max();
+
+    for (int l = 0; l < levels; l++)
+    {
+        int current = static_cast<int>((now >> (slot_bits * l)) & (slots - 1));
+        uint64_t ahead = current == slots - 1 ? 0 : occupied[l] & (~uint64_t(0) << (current + 1));
+        if (ahead != 0)
+        {
+            int64_t rotation = (now >> (slot_bits * (l + 1))) << (slot_bits * (l + 1));
+            int64_t tick = rotation + (int64_t(std::countr_zero(ahead)) << (slot_bits * l));
+            event = tick < event ? tick : event;
+        }
+    }
+
+    if (heads[overflow_list] != -1)
+    {
+        int64_t tick = ((now >> (slot_bits * levels)) + 1) << (slot_bits * levels);
+        event = tick < event ? tick : event;
+    }
+
+    return event;
+}
+
+template <typename t_key>
+int timing_wheel<t_key>::list_for(int64_t deadline) const
+{
+    if (deadline <= now)
+    {
+        return due_list;
+    }
+
+    for (int l = 0; l < levels; l++)
+    {
+        int shift = slot_bits * (l + 1);
+        if ((deadline >> shift) == (now >> shift))
+        {
+            return l * slots + static_cast<int>((deadline >> (slot_bits * l)) & (slots - 1));
+        }
+    }
+
+    return overflow_list;
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::place(int node)
+{
+    link(node, list_for(nodes[node].deadline));
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::link(int node, int list)
+{
+    nodes[node].list = list;
+    nodes[node].prev = -1;
+    nodes[node].next = heads[list];
+    if (heads[list] != -1)
+    {
+        nodes[heads[list]].prev = node;
+    }
+    heads[list] = node;
+
+    if (list < due_list)
+    {
+        occupied[list / slots] |= uint64_t(1) << (list % slots);
+    }
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::unlink(int node)
+{
+    int list = nodes[node].list;
+    int prev = nodes[node].prev;
+    int next = nodes[node].next;
+
+    if (prev != -1)
+    {
+        nodes[prev].next = next;
+    }
+    else
+    {
+        heads[list] = next;
+    }
+    if (next != -1)
+    {
+        nodes[next].prev = prev;
+    }
+
+    if (list < due_list && heads[list] == -1)
+    {
+        occupied[list / slots] &= ~(uint64_t(1) << (list % slots));
+    }
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::release(int node)
+{
+    unlink(node);
+    index.erase(nodes[node].key);
+    nodes[node].next = free_node;
+    free_node = node;
+    count--;
+}
+
+template <typename t_key>
+void timing_wheel<t_key>::cascade(int list)
+{
+    int node = heads[list];
+    heads[list] = -1;
+    if (list < due_list)
+    {
+        occupied[list / slots] &= ~(uint64_t(1) << (list % slots));
+    }
+
+    while (node != -1)
+    {
+        int next = nodes[node].next;
+        place(node);
+        node = next;
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "trace_record.hpp"
+#include <fstream>
+#include <string>
+
+template <typename t_key, typename t_value>
+class trace_reader
+{
+private:
+    std::string file_path;
+    std::ifstream file;
+
+public:
+    explicit trace_reader(const std::string &path);
+    ~trace_reader() = default;
+
+    bool next(trace_record<t_key, t_value> &record);
+    void reset();
+
+private:
+    void read_header();
+};
+
+#include "trace_reader.tpp"
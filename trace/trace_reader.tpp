@@ -0,0 +1,72 @@
+#include "trace_reader.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+trace_reader<t_key, t_value>::trace_reader(const std::string &path)
+    : file_path(path), file(path, std::ios::binary | std::ios::in)
+{
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+    read_header();
+}
+
+template <typename t_key, typename t_value>
+bool trace_reader<t_key, t_value>::next(trace_record<t_key, t_value> &record)
+{
+    int op = file.get();
+    if (op == std::ifstream::traits_type::eof())
+    {
+        return false;
+    }
+    if (op != static_cast<int>(trace_op::get) && op != static_cast<int>(trace_op::put))
+    {
+        throw std::runtime_error("Corrupted trace record in " + file_path);
+    }
+
+    record.op = static_cast<trace_op>(op);
+    file.read(reinterpret_cast<char *>(&record.key), sizeof(t_key));
+    if (record.op == trace_op::put)
+    {
+        file.read(reinterpret_cast<char *>(&record.value), sizeof(t_value));
+    }
+    if (!file)
+    {
+        throw std::runtime_error("Incomplete read");
+    }
+    return true;
+}
+
+template <typename t_key, typename t_value>
+void trace_reader<t_key, t_value>::reset()
+{
+    file.clear();
+    file.seekg(0, std::ios::beg);
+    read_header();
+}
+
+template <typename t_key, typename t_value>
+void trace_reader<t_key, t_value>::read_header()
+{
+    char magic[sizeof(trace_magic)];
+    uint32_t layout[3];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(layout), sizeof(layout));
+    if (!file)
+    {
+        throw std::runtime_error("Incomplete read");
+    }
+
+    for (int i = 0; i < static_cast<int>(sizeof(trace_magic)); i++)
+    {
+        if (magic[i] != trace_magic[i])
+        {
+            throw std::runtime_error("Not a trace file: " + file_path);
+        }
+    }
+    if (layout[0] != trace_version || layout[1] != sizeof(t_key) || layout[2] != sizeof(t_value))
+    {
+        throw std::runtime_error("Trace layout does not match key/value types: " + file_path);
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+enum class trace_op : uint8_t
+{
+    get = 0,
+    put = 1
+};
+
+template <typename t_key, typename t_value>
+struct trace_record
+{
+    trace_op op;
+    t_key key;
+    t_value value;
+
+    trace_record() = default;
+    trace_record(trace_op op, const t_key &key, const t_value &value = t_value()) : op(op), key(key), value(value) {}
+};
+
+const char trace_magic[4] = {'H', 'S', 'T', 'R'};
+const uint32_t trace_version = 2;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "trace_reader.hpp"
+#include "trace_writer.hpp"
+#include "../lab3_2ndsem/headers/array_sequence.hpp"
+#include <functional>
+#include <string>
+
+struct replay_result
+{
+    int capacity;
+    int requests;
+    int not_found;
+    double duration_ms;
+    double throughput;
+    double hit_ratio;
+    double p50_us;
+    double p90_us;
+    double p99_us;
+    double p999_us;
+    double max_us;
+};
+
+template <typename t_key, typename t_value, typename t_cache>
+replay_result replay_trace(const std::string &trace_path, t_cache &target, int capacity = 0);
+
+template <typename t_key, typename t_value, typename t_cache>
+array_sequence<replay_result> replay_trace_sizes(const std::string &trace_path,
+                                                 const array_sequence<int> &capacities,
+                                                 const std::function<t_cache *(int)> &make_cache);
+
+template <typename t_key, typename t_value>
+void write_workload_trace(const std::string &trace_path, const array_sequence<t_key> &workload);
+
+#include "trace_replay.tpp"
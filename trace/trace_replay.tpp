@@ -0,0 +1,98 @@
+#include "trace_replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+template <typename t_key, typename t_value, typename t_cache>
+replay_result replay_trace(const std::string &trace_path, t_cache &target, int capacity)
+{
+    trace_reader<t_key, t_value> reader(trace_path);
+    trace_record<t_key, t_value> record;
+    std::vector<double> latencies;
+    int not_found = 0;
+
+    target.reset_statistics();
+    auto start = std::chrono::steady_clock::now();
+    while (reader.next(record))
+    {
+        auto op_start = std::chrono::steady_clock::now();
+        if (record.op == trace_op::put)
+        {
+            target.put(record.key, record.value);
+        }
+        else
+        {
+            try
+            {
+                target.get(record.key);
+            }
+            catch (const std::out_of_range &)
+            {
+                not_found++;
+            }
+        }
+        auto op_end = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(op_end - op_start).count());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    replay_result result{};
+    result.capacity = capacity;
+    result.requests = static_cast<int>(latencies.size());
+    result.not_found = not_found;
+    result.duration_ms = std::chrono::duration<double, std::milli>(end - start).count();
+    result.throughput = result.duration_ms > 0 ? result.requests / (result.duration_ms / 1000.0) : 0.0;
+    result.hit_ratio = target.get_hit_ratio();
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p)
+        {
+            size_t index = static_cast<size_t>(p * (latencies.size() - 1));
+            return latencies[index];
+        };
+        result.p50_us = percentile(0.50);
+        result.p90_us = percentile(0.90);
+        result.p99_us = percentile(0.99);
+        result.p999_us = percentile(0.999);
+        result.max_us = latencies.back();
+    }
+
+    return result;
+}
+
+template <typename t_key, typename t_value, typename t_cache>
+array_sequence<replay_result> replay_trace_sizes(const std::string &trace_path,
+                                                 const array_sequence<int> &capacities,
+                                                 const std::function<t_cache *(int)> &make_cache)
+{
+    array_sequence<replay_result> results;
+    for (int i = 0; i < capacities.get_length(); i++)
+    {
+        t_cache *target = make_cache(capacities.get(i));
+        try
+        {
+            results.append_element(replay_trace<t_key, t_value>(trace_path, *target, capacities.get(i)));
+        }
+        catch (...)
+        {
+            delete target;
+            throw;
+        }
+        delete target;
+    }
+    return results;
+}
+
+template <typename t_key, typename t_value>
+void write_workload_trace(const std::string &trace_path, const array_sequence<t_key> &workload)
+{
+    trace_writer<t_key, t_value> writer(trace_path);
+    for (int i = 0; i < workload.get_length(); i++)
+    {
+        writer.record_get(workload.get(i));
+    }
+    writer.close();
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "trace_record.hpp"
+#include <fstream>
+#include <string>
+
+template <typename t_key, typename t_value>
+class trace_writer
+{
+private:
+    std::string file_path;
+    std::ofstream file;
+    int record_count;
+
+public:
+    explicit trace_writer(const std::string &path);
+    ~trace_writer();
+
+    void record_get(const t_key &key);
+    void record_put(const t_key &key, const t_value &value);
+    void write(const trace_record<t_key, t_value> &record);
+    void flush();
+    void close();
+
+    int get_record_count() const;
+};
+
+#include "trace_writer.tpp"
@@ -0,0 +1,79 @@
+#include "trace_writer.hpp"
+#include <stdexcept>
+
+template <typename t_key, typename t_value>
+trace_writer<t_key, t_value>::trace_writer(const std::string &path)
+    : file_path(path), file(path, std::ios::binary | std::ios::out | std::ios::trunc), record_count(0)
+{
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+
+    const uint32_t layout[3] = {trace_version, static_cast<uint32_t>(sizeof(t_key)), static_cast<uint32_t>(sizeof(t_value))};
+    file.write(trace_magic, sizeof(trace_magic));
+    file.write(reinterpret_cast<const char *>(layout), sizeof(layout));
+}
+
+template <typename t_key, typename t_value>
+trace_writer<t_key, t_value>::~trace_writer()
+{
+    close();
+}
+
+template <typename t_key, typename t_value>
+void trace_writer<t_key, t_value>::record_get(const t_key &key)
+{
+    write(trace_record<t_key, t_value>(trace_op::get, key));
+}
+
+template <typename t_key, typename t_value>
+void trace_writer<t_key, t_value>::record_put(const t_key &key, const t_value &value)
+{
+    write(trace_record<t_key, t_value>(trace_op::put, key, value));
+}
+
+template <typename t_key, typename t_value>
+void trace_writer<t_key, t_value>::write(const trace_record<t_key, t_value> &record)
+{
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+
+    file.put(static_cast<char>(record.op));
+    file.write(reinterpret_cast<const char *>(&record.key), sizeof(t_key));
+    if (record.op == trace_op::put)
+    {
+        file.write(reinterpret_cast<const char *>(&record.value), sizeof(t_value));
+    }
+    if (!file.good())
+    {
+        throw std::runtime_error("Write error");
+    }
+    ++record_count;
+}
+
+template <typename t_key, typename t_value>
+void trace_writer<t_key, t_value>::flush()
+{
+    if (file.is_open())
+    {
+        file.flush();
+    }
+}
+
+template <typename t_key, typename t_value>
+void trace_writer<t_key, t_value>::close()
+{
+    if (file.is_open())
+    {
+        file.close();
+    }
+}
+
+template <typename t_key, typename t_value>
+int trace_writer<t_key, t_value>::get_record_count() const
+{
+    return record_count;
+}